@@ -16,8 +16,10 @@
 #include "ScopedExecutor.h"
 #include "WeakList.h"
 
+#include <functional>
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include <jsinspector-modern/tracing/TracingMode.h>
 #include <jsinspector-modern/tracing/TracingState.h>
@@ -209,8 +211,13 @@ class HostTargetController final {
 
   /**
    * Stops previously started trace recording.
+   *
+   * \param performanceTraceEventsChunkCallback If set, receives the Trace
+   * Events of the PerformanceTracer as chunks of JSON arrays as soon as they
+   * are serialized. They are not included in the returned state then.
    */
-  tracing::TraceRecordingState stopTracing();
+  tracing::TraceRecordingState stopTracing(
+      std::function<void(std::string_view chunk)> performanceTraceEventsChunkCallback = nullptr);
 
  private:
   HostTarget &target_;
@@ -298,8 +305,13 @@ class JSINSPECTOR_EXPORT HostTarget : public EnableExecutorFromThis<HostTarget>
 
   /**
    * Stops previously started trace recording.
+   *
+   * \param performanceTraceEventsChunkCallback If set, receives the Trace
+   * Events of the PerformanceTracer as chunks of JSON arrays as soon as they
+   * are serialized. They are not included in the returned state then.
    */
-  tracing::TraceRecordingState stopTracing();
+  tracing::TraceRecordingState stopTracing(
+      std::function<void(std::string_view chunk)> performanceTraceEventsChunkCallback = nullptr);
 
   /**
    * Returns the state of the background trace, running, stopped, or disabled
@@ -36,16 +36,21 @@ void HostTargetTraceRecording::start() {
   hostTracingAgent_ = hostTarget_.createTracingAgent(*state_);
 }
 
-tracing::TraceRecordingState HostTargetTraceRecording::stop() {
+tracing::TraceRecordingState HostTargetTraceRecording::stop(
+    std::function<void(std::string_view chunk)>
+        performanceTraceEventsChunkCallback) {
   assert(
       hostTracingAgent_ != nullptr &&
       "TracingAgent for the HostTarget has not been initialized.");
-  hostTracingAgent_.reset();
-
   assert(
       state_.has_value() &&
       "The state for this tracing session has not been initialized.");
+  state_->performanceTraceEventsChunkCallback =
+      std::move(performanceTraceEventsChunkCallback);
+  hostTracingAgent_.reset();
+
   auto state = std::move(*state_);
+  state.performanceTraceEventsChunkCallback = nullptr;
   state_.reset();
 
   return state;
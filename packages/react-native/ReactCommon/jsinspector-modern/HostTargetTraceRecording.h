@@ -55,9 +55,11 @@ class HostTargetTraceRecording {
   /**
    * Stops the recording and drops the recording state.
    *
-   * Will deallocate all Tracing Agents.
+   * Will deallocate all Tracing Agents, which pass the serialized Trace Events
+   * of the PerformanceTracer to \p performanceTraceEventsChunkCallback, if set.
    */
-  tracing::TraceRecordingState stop();
+  tracing::TraceRecordingState stop(
+      std::function<void(std::string_view chunk)> performanceTraceEventsChunkCallback = nullptr);
 
  private:
   /**
@@ -16,8 +16,10 @@ bool HostTargetController::startTracing(tracing::Mode tracingMode) {
   return target_.startTracing(tracingMode);
 }
 
-tracing::TraceRecordingState HostTargetController::stopTracing() {
-  return target_.stopTracing();
+tracing::TraceRecordingState HostTargetController::stopTracing(
+    std::function<void(std::string_view chunk)>
+        performanceTraceEventsChunkCallback) {
+  return target_.stopTracing(std::move(performanceTraceEventsChunkCallback));
 }
 
 std::shared_ptr<HostTracingAgent> HostTarget::createTracingAgent(
@@ -45,10 +47,13 @@ bool HostTarget::startTracing(tracing::Mode tracingMode) {
   return true;
 }
 
-tracing::TraceRecordingState HostTarget::stopTracing() {
+tracing::TraceRecordingState HostTarget::stopTracing(
+    std::function<void(std::string_view chunk)>
+        performanceTraceEventsChunkCallback) {
   assert(traceRecording_ != nullptr && "No tracing in progress");
 
-  auto state = traceRecording_->stop();
+  auto state =
+      traceRecording_->stop(std::move(performanceTraceEventsChunkCallback));
   traceRecording_.reset();
 
   return state;
@@ -22,6 +22,12 @@ namespace {
 constexpr HighResDuration kBackgroundTracePerformanceTracerWindowSize =
     HighResDuration::fromMilliseconds(20000);
 
+/**
+ * Threshold for the size of the chunks of Performance Trace Events, each of
+ * which will be flushed out with a single Tracing.dataCollected event.
+ */
+constexpr uint16_t kPerformanceTraceEventsChunkSize = 1000;
+
 } // namespace
 
 InstanceAgent::InstanceAgent(
@@ -180,11 +186,23 @@ InstanceTracingAgent::InstanceTracingAgent(tracing::TraceRecordingState& state)
 
 InstanceTracingAgent::~InstanceTracingAgent() {
   auto& performanceTracer = tracing::PerformanceTracer::getInstance();
-  auto performanceTraceEvents = performanceTracer.stopTracing();
-  if (performanceTraceEvents) {
+  std::vector<std::string> performanceTraceEventChunks;
+  auto didStopTracing = performanceTracer.stopTracing(
+      [&](std::string&& eventsChunk) {
+        // Chunks are only kept if nobody is waiting for them, e.g. when the
+        // recording is emitted later.
+        if (state_.performanceTraceEventsChunkCallback) {
+          state_.performanceTraceEventsChunkCallback(eventsChunk);
+        } else {
+          performanceTraceEventChunks.push_back(std::move(eventsChunk));
+        }
+      },
+      kPerformanceTraceEventsChunkSize);
+  if (didStopTracing) {
     state_.instanceTracingProfiles.emplace_back(
         tracing::InstanceTracingProfile{
-            .performanceTraceEvents = std::move(*performanceTraceEvents),
+            .performanceTraceEventChunks =
+                std::move(performanceTraceEventChunks),
         });
   }
 }
@@ -17,12 +17,6 @@ namespace facebook::react::jsinspector_modern {
 
 namespace {
 
-/**
- * Threshold for the size Trace Event chunk, that will be flushed out with
- * Tracing.dataCollected event.
- */
-const uint16_t TRACE_EVENT_CHUNK_SIZE = 1000;
-
 /**
  * The maximum number of ProfileChunk trace events
  * that will be sent in a single CDP Tracing.dataCollected message.
@@ -82,11 +76,15 @@ bool TracingAgent::handleRequest(const cdp::PreparsedRequest& req) {
     return true;
   } else if (req.method == "Tracing.end") {
     // @cdp Tracing.end support is experimental.
-    auto state = hostTargetController_.stopTracing();
+    // Send response to Tracing.end request before stopping, since the Trace
+    // Events of the PerformanceTracer are sent as soon as they are serialized.
+    frontendChannel_(cdp::jsonResult(req.id));
 
+    auto state = hostTargetController_.stopTracing(
+        [this](std::string_view eventsChunk) {
+          emitDataCollected(eventsChunk);
+        });
     sessionState_.hasPendingTraceRecording = false;
-    // Send response to Tracing.end request.
-    frontendChannel_(cdp::jsonResult(req.id));
 
     emitTraceRecording(std::move(state));
     return true;
@@ -102,18 +100,23 @@ void TracingAgent::emitExternalTraceRecording(
   emitTraceRecording(std::move(traceRecording));
 }
 
+void TracingAgent::emitDataCollected(std::string_view eventsChunk) const {
+  // Chunks are already serialized, so the notifications are put together
+  // without parsing them again.
+  constexpr std::string_view prefix =
+      R"({"method":"Tracing.dataCollected","params":{"value":)";
+  constexpr std::string_view suffix = "}}";
+  std::string message;
+  message.reserve(prefix.size() + eventsChunk.size() + suffix.size());
+  message.append(prefix).append(eventsChunk).append(suffix);
+  frontendChannel_(message);
+}
+
 void TracingAgent::emitTraceRecording(
     tracing::TraceRecordingState traceRecording) const {
-  auto dataCollectedCallback = [this](folly::dynamic&& eventsChunk) {
-    frontendChannel_(
-        cdp::jsonNotification(
-            "Tracing.dataCollected",
-            folly::dynamic::object("value", std::move(eventsChunk))));
-  };
   tracing::TraceRecordingStateSerializer::emitAsDataCollectedChunks(
       std::move(traceRecording),
-      dataCollectedCallback,
-      TRACE_EVENT_CHUNK_SIZE,
+      [this](std::string_view eventsChunk) { emitDataCollected(eventsChunk); },
       PROFILE_TRACE_EVENT_CHUNK_SIZE);
 
   frontendChannel_(
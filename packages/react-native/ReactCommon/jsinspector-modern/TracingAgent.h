@@ -55,6 +55,12 @@ class TracingAgent {
 
   HostTargetController &hostTargetController_;
 
+  /**
+   * Emits a Tracing.dataCollected event with an already serialized JSON array
+   * of Trace Events.
+   */
+  void emitDataCollected(std::string_view eventsChunk) const;
+
   /**
    * Emits the captured Trace Recording state in a series of
    * Tracing.dataCollected events, followed by a Tracing.tracingComplete event.
@@ -7,12 +7,16 @@
 
 #pragma once
 
-#include "TraceEvent.h"
+#include <string>
+#include <vector>
 
 namespace facebook::react::jsinspector_modern::tracing {
 
 struct InstanceTracingProfile {
-  std::vector<TraceEvent> performanceTraceEvents;
+  // The Trace Events of the PerformanceTracer, serialized into chunks of JSON
+  // arrays when tracing stopped. Empty if they were passed to the
+  // `performanceTraceEventsChunkCallback` of the recording instead.
+  std::vector<std::string> performanceTraceEventChunks;
 };
 
 } // namespace facebook::react::jsinspector_modern::tracing
@@ -16,7 +16,10 @@
 
 #include <folly/json.h>
 
+#include <algorithm>
+#include <iterator>
 #include <mutex>
+#include <queue>
 
 using namespace facebook::react;
 
@@ -75,6 +78,12 @@ bool PerformanceTracer::startTracingImpl(
     currentTraceStartTime_ = HighResTimeStamp::now();
     currentTraceMaxDuration_ = maxDuration;
 
+    for (auto& threadEventBuffer : threadEventBuffers_) {
+      std::lock_guard threadEventBufferLock(threadEventBuffer->mutex);
+      threadEventBuffer->maxDuration = maxDuration;
+      threadEventBuffer->currentWindowStartTime = currentTraceStartTime_;
+    }
+
     for (const auto& [id, callback] : tracingStateCallbacks_) {
       callbacksToNotify.push_back(callback);
     }
@@ -89,6 +98,41 @@ bool PerformanceTracer::startTracingImpl(
 
 std::optional<std::vector<TraceEvent>> PerformanceTracer::stopTracing() {
   std::vector<TraceEvent> events;
+  auto didStopTracing = stopTracingImpl(
+      [&](TraceEvent&& event) { events.push_back(std::move(event)); });
+  if (!didStopTracing) {
+    return std::nullopt;
+  }
+
+  return events;
+}
+
+bool PerformanceTracer::stopTracing(
+    const std::function<void(std::string&& eventsChunk)>& chunkCallback,
+    uint16_t chunkSize) {
+  std::string chunk;
+  uint16_t chunkEventCount = 0;
+  auto didStopTracing = stopTracingImpl([&](TraceEvent&& event) {
+    chunk.push_back(chunkEventCount == 0 ? '[' : ',');
+    TraceEventSerializer::serializeToJson(event, chunk);
+    if (++chunkEventCount == chunkSize) {
+      chunk.push_back(']');
+      chunkCallback(std::move(chunk));
+      chunk = std::string();
+      chunkEventCount = 0;
+    }
+  });
+
+  if (chunkEventCount > 0) {
+    chunk.push_back(']');
+    chunkCallback(std::move(chunk));
+  }
+
+  return didStopTracing;
+}
+
+bool PerformanceTracer::stopTracingImpl(
+    const std::function<void(TraceEvent&& event)>& eventCallback) {
   std::vector<TracingStateCallback> callbacksToNotify;
 
   auto currentTraceEndTime = HighResTimeStamp::now();
@@ -97,7 +141,7 @@ std::optional<std::vector<TraceEvent>> PerformanceTracer::stopTracing() {
     std::lock_guard lock(mutex_);
 
     if (!tracingAtomic_) {
-      return std::nullopt;
+      return false;
     }
 
     // Collect callbacks before disabling tracing
@@ -112,20 +156,32 @@ std::optional<std::vector<TraceEvent>> PerformanceTracer::stopTracing() {
     callback(false);
   }
 
+  // Only the recorded events are taken out of the buffers under the lock. They
+  // are merged, converted and passed on after releasing it, so that threads
+  // can keep registering buffers and the callback can use the tracer.
+  std::vector<ThreadEventRecording> recordings;
+  HighResTimeStamp currentTraceStartTime;
+  std::optional<HighResDuration> currentTraceMaxDuration;
+
   {
     std::lock_guard lock(mutex_);
 
     tracingAtomic_ = false;
-    performanceMeasureCount_ = 0;
-
-    alreadyEmittedEntryForComponentsTrackOrdering_ = false;
-    events = collectEventsAndClearBuffers(currentTraceEndTime);
+    currentTraceStartTime = currentTraceStartTime_;
+    currentTraceMaxDuration = currentTraceMaxDuration_;
+    currentTraceMaxDuration_ = std::nullopt;
+    recordings = takeThreadEventRecordings();
   }
 
-  auto currentTraceStartTime = currentTraceStartTime_;
-  if (currentTraceMaxDuration_ &&
-      currentTraceEndTime - *currentTraceMaxDuration_ > currentTraceStartTime) {
-    currentTraceStartTime = currentTraceEndTime - *currentTraceMaxDuration_;
+  collectEvents(
+      std::move(recordings),
+      currentTraceEndTime,
+      currentTraceMaxDuration,
+      eventCallback);
+
+  if (currentTraceMaxDuration &&
+      currentTraceEndTime - *currentTraceMaxDuration > currentTraceStartTime) {
+    currentTraceStartTime = currentTraceEndTime - *currentTraceMaxDuration;
   }
 
   // This is synthetic Trace Event, which should not be represented on a
@@ -135,7 +191,7 @@ std::optional<std::vector<TraceEvent>> PerformanceTracer::stopTracing() {
   // This could happen for non-bridgeless apps, where Performance interface is
   // not supported and no spec-compliant Event Loop implementation.
 
-  events.emplace_back(
+  eventCallback(
       TraceEvent{
           .name = "TracingStartedInPage",
           .cat = "disabled-by-default-devtools.timeline",
@@ -146,7 +202,7 @@ std::optional<std::vector<TraceEvent>> PerformanceTracer::stopTracing() {
           .args = folly::dynamic::object("data", folly::dynamic::object()),
       });
 
-  events.emplace_back(
+  eventCallback(
       TraceEvent{
           .name = "ReactNative-TracingStopped",
           .cat = "disabled-by-default-devtools.timeline",
@@ -156,9 +212,7 @@ std::optional<std::vector<TraceEvent>> PerformanceTracer::stopTracing() {
           .tid = getCurrentThreadId(),
       });
 
-  currentTraceMaxDuration_ = std::nullopt;
-
-  return events;
+  return true;
 }
 
 void PerformanceTracer::reportMark(
@@ -169,14 +223,16 @@ void PerformanceTracer::reportMark(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
+  auto& threadEventBuffer = getThreadEventBuffer();
+  std::lock_guard<std::mutex> lock(threadEventBuffer.mutex);
   if (!tracingAtomic_) {
     return;
   }
 
-  enqueueEvent(
+  auto& window = threadEventBuffer.getCurrentWindow();
+  window.events.emplace_back(
       PerformanceTracerEventMark{
-          .name = name,
+          .name = window.intern(name),
           .start = start,
           .detail = std::move(detail),
           .threadId = getCurrentThreadId(),
@@ -192,14 +248,16 @@ void PerformanceTracer::reportMeasure(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
+  auto& threadEventBuffer = getThreadEventBuffer();
+  std::lock_guard<std::mutex> lock(threadEventBuffer.mutex);
   if (!tracingAtomic_) {
     return;
   }
 
-  enqueueEvent(
+  auto& window = threadEventBuffer.getCurrentWindow();
+  window.events.emplace_back(
       PerformanceTracerEventMeasure{
-          .name = name,
+          .name = window.intern(name),
           .start = start,
           .duration = duration,
           .detail = std::move(detail),
@@ -219,18 +277,20 @@ void PerformanceTracer::reportTimeStamp(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
+  auto& threadEventBuffer = getThreadEventBuffer();
+  std::lock_guard<std::mutex> lock(threadEventBuffer.mutex);
   if (!tracingAtomic_) {
     return;
   }
 
-  enqueueEvent(
+  auto& window = threadEventBuffer.getCurrentWindow();
+  window.events.emplace_back(
       PerformanceTracerEventTimeStamp{
-          .name = name,
+          .name = window.intern(name),
           .start = std::move(start),
           .end = std::move(end),
-          .trackName = std::move(trackName),
-          .trackGroup = std::move(trackGroup),
+          .trackName = window.intern(trackName),
+          .trackGroup = window.intern(trackGroup),
           .color = std::move(color),
           .detail = std::move(detail),
           .threadId = getCurrentThreadId(),
@@ -244,12 +304,13 @@ void PerformanceTracer::reportEventLoopTask(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
+  auto& threadEventBuffer = getThreadEventBuffer();
+  std::lock_guard<std::mutex> lock(threadEventBuffer.mutex);
   if (!tracingAtomic_) {
     return;
   }
 
-  enqueueEvent(
+  threadEventBuffer.enqueue(
       PerformanceTracerEventEventLoopTask{
           .start = start,
           .end = end,
@@ -264,12 +325,13 @@ void PerformanceTracer::reportEventLoopMicrotasks(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
+  auto& threadEventBuffer = getThreadEventBuffer();
+  std::lock_guard<std::mutex> lock(threadEventBuffer.mutex);
   if (!tracingAtomic_) {
     return;
   }
 
-  enqueueEvent(
+  threadEventBuffer.enqueue(
       PerformanceTracerEventEventLoopMicrotask{
           .start = start,
           .end = end,
@@ -287,7 +349,8 @@ void PerformanceTracer::reportResourceSendRequest(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
+  auto& threadEventBuffer = getThreadEventBuffer();
+  std::lock_guard<std::mutex> lock(threadEventBuffer.mutex);
   if (!tracingAtomic_) {
     return;
   }
@@ -295,7 +358,7 @@ void PerformanceTracer::reportResourceSendRequest(
   auto resourceType =
       jsinspector_modern::cdp::network::resourceTypeFromMimeType(
           jsinspector_modern::mimeTypeFromHeaders(headers));
-  enqueueEvent(
+  threadEventBuffer.enqueue(
       PerformanceTracerResourceSendRequest{
           .requestId = devtoolsRequestId,
           .url = url,
@@ -317,12 +380,13 @@ void PerformanceTracer::reportResourceReceiveResponse(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
+  auto& threadEventBuffer = getThreadEventBuffer();
+  std::lock_guard<std::mutex> lock(threadEventBuffer.mutex);
   if (!tracingAtomic_) {
     return;
   }
 
-  enqueueEvent(
+  threadEventBuffer.enqueue(
       PerformanceTracerResourceReceiveResponse{
           .requestId = devtoolsRequestId,
           .start = start,
@@ -345,12 +409,13 @@ void PerformanceTracer::reportResourceFinish(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
+  auto& threadEventBuffer = getThreadEventBuffer();
+  std::lock_guard<std::mutex> lock(threadEventBuffer.mutex);
   if (!tracingAtomic_) {
     return;
   }
 
-  enqueueEvent(
+  threadEventBuffer.enqueue(
       PerformanceTracerResourceFinish{
           .requestId = devtoolsRequestId,
           .start = start,
@@ -408,101 +473,230 @@ PerformanceTracer::constructRuntimeProfileChunkTraceEvent(
 #pragma mark - Tracing window methods
 
 /**
- * If a `maxDuration` value is set when starting a trace, we use 2 buffers
- * for events. Each buffer can contain entries for a range up to `maxDuration`.
- * When the current buffer is full, we clear the previous one and we start
- * collecting events in a new buffer, which becomes current.
+ * If a `maxDuration` value is set when starting a trace, the buffer of every
+ * thread uses 2 windows for events. Each window can contain entries for a
+ * range up to `maxDuration`.
+ * When the current window is full, we clear the previous one and we start
+ * collecting events in a new window, which becomes current.
  *
  * Example:
  *   - Start:
- *     previousBuffer: null, currentBuffer: []
+ *     previousWindow: null, currentWindow: []
  *   - As entries are added:
- *     previousBuffer: null, currentBuffer: [a, b, c...]
- *   - When now - currentBuffer start time > maxDuration:
- *     previousBuffer: [a, b, c...], currentBuffer: []
+ *     previousWindow: null, currentWindow: [a, b, c...]
+ *   - When now - currentWindow start time > maxDuration:
+ *     previousWindow: [a, b, c...], currentWindow: []
  *   - As entries are added:
- *     previousbuffer: [a, b, c...], currentBuffer: [x, y, z...]
- *   - When now - currentBuffer start time > maxDuration:
- *     previousBuffer: [x, y, z...], currentBuffer: []
+ *     previousWindow: [a, b, c...], currentWindow: [x, y, z...]
+ *   - When now - currentWindow start time > maxDuration:
+ *     previousWindow: [x, y, z...], currentWindow: []
  *   - When the trace finishes:
- *     We collect all events in both buffers that are still within
+ *     We collect all events in both windows that are still within
  *     `maxDuration`.
  *
  * This way, we ensure we keep all events in the `maxDuration` window, and
- * clearing expired events is trivial (just clearing a vector).
+ * clearing expired events is trivial (just clearing a window). Every window
+ * interns the names of its own events, so they are released with them.
  */
 
-std::vector<TraceEvent> PerformanceTracer::collectEventsAndClearBuffers(
-    HighResTimeStamp currentTraceEndTime) {
-  std::vector<TraceEvent> events;
+std::vector<PerformanceTracer::ThreadEventRecording>
+PerformanceTracer::takeThreadEventRecordings() {
+  std::vector<ThreadEventRecording> recordings;
+  recordings.reserve(threadEventBuffers_.size());
+
+  for (auto& threadEventBuffer : threadEventBuffers_) {
+    std::lock_guard lock(threadEventBuffer->mutex);
+
+    auto& recording = recordings.emplace_back();
+    if (threadEventBuffer->previousWindow != nullptr) {
+      recording.previousWindow = std::move(*threadEventBuffer->previousWindow);
+    }
+    recording.currentWindow = std::move(*threadEventBuffer->currentWindow);
+
+    // Reset state. Taking the events out also releases the capacity of the
+    // windows.
+    threadEventBuffer->window = {};
+    threadEventBuffer->altWindow = {};
+    threadEventBuffer->currentWindow = &threadEventBuffer->window;
+    threadEventBuffer->previousWindow = nullptr;
+  }
+
+  // The events of exited threads were taken, so their buffers can go.
+  std::erase_if(threadEventBuffers_, [](const auto& threadEventBuffer) {
+    return threadEventBuffer->threadExited;
+  });
+
+  return recordings;
+}
+
+void PerformanceTracer::collectEvents(
+    std::vector<ThreadEventRecording>&& recordings,
+    HighResTimeStamp currentTraceEndTime,
+    std::optional<HighResDuration> currentTraceMaxDuration,
+    const std::function<void(TraceEvent&& event)>& eventCallback) {
+  // Every thread records its events in the order in which they were created,
+  // so the sequences of all threads are merged without sorting them. Both the
+  // previous and the current events of a thread are a sequence; ties are
+  // resolved by the position of the sequence, which keeps the events of a
+  // thread and the threads themselves in order.
+  struct EventSequence {
+    std::vector<PerformanceTracerEvent>* events;
+    size_t position;
+  };
 
-  if (currentTraceMaxDuration_) {
-    // Collect non-expired entries from the previous buffer
-    if (previousBuffer_ != nullptr) {
-      collectEventsAndClearBuffer(
-          events, *previousBuffer_, currentTraceEndTime);
+  std::vector<EventSequence> sequences;
+  sequences.reserve(recordings.size() * 2);
+  for (auto& recording : recordings) {
+    for (auto* events :
+         {&recording.previousWindow.events, &recording.currentWindow.events}) {
+      // Events which are out of the tracing window are at the start of a
+      // sequence.
+      auto firstEventInWindow = std::partition_point(
+          events->begin(),
+          events->end(),
+          [&](const PerformanceTracerEvent& event) {
+            return currentTraceMaxDuration &&
+                getCreatedAt(event) <=
+                currentTraceEndTime - *currentTraceMaxDuration;
+          });
+      sequences.push_back(
+          EventSequence{
+              .events = events,
+              .position = static_cast<size_t>(
+                  std::distance(events->begin(), firstEventInWindow)),
+          });
     }
+  }
 
-    collectEventsAndClearBuffer(events, *currentBuffer_, currentTraceEndTime);
+  using HeapEntry = std::pair<HighResTimeStamp, size_t>;
+  std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<>>
+      nextEvents;
+  for (size_t i = 0; i < sequences.size(); i++) {
+    auto& sequence = sequences[i];
+    if (sequence.position < sequence.events->size()) {
+      nextEvents.emplace(
+          getCreatedAt((*sequence.events)[sequence.position]), i);
+    }
+  }
 
-    // Reset state.
-    currentBuffer_ = &buffer_;
-    previousBuffer_ = nullptr;
-  } else {
-    // Trivial case.
-    events.reserve(currentBuffer_->size());
-    for (auto&& event : *currentBuffer_) {
-      enqueueTraceEventsFromPerformanceTracerEvent(events, std::move(event));
+  // Events are passed on one by one, so they can be serialized without
+  // converting the whole recording first. The interned names are kept alive
+  // until all events are converted.
+  TraceEventConversionState conversionState;
+  std::vector<TraceEvent> events;
+  while (!nextEvents.empty()) {
+    auto index = nextEvents.top().second;
+    nextEvents.pop();
+
+    auto& sequence = sequences[index];
+    enqueueTraceEventsFromPerformanceTracerEvent(
+        events,
+        std::move((*sequence.events)[sequence.position++]),
+        conversionState);
+    for (auto& traceEvent : events) {
+      eventCallback(std::move(traceEvent));
+    }
+    events.clear();
+
+    if (sequence.position < sequence.events->size()) {
+      nextEvents.emplace(
+          getCreatedAt((*sequence.events)[sequence.position]), index);
+    } else {
+      // Release the converted events of the sequence right away.
+      *sequence.events = {};
     }
-    currentBuffer_->clear();
   }
+}
 
-  return events;
+PerformanceTracer::ThreadEventBuffer&
+PerformanceTracer::getThreadEventBuffer() {
+  // The tracer is a singleton, so every thread has at most one buffer.
+  static thread_local ThreadEventBufferRegistration registration;
+  if (registration.threadEventBuffer == nullptr) [[unlikely]] {
+    std::lock_guard lock(mutex_);
+    auto& newThreadEventBuffer = threadEventBuffers_.emplace_back(
+        std::make_unique<ThreadEventBuffer>());
+    newThreadEventBuffer->maxDuration = currentTraceMaxDuration_;
+    newThreadEventBuffer->currentWindowStartTime = currentTraceStartTime_;
+    registration.threadEventBuffer = newThreadEventBuffer.get();
+  }
+  return *registration.threadEventBuffer;
 }
 
-void PerformanceTracer::collectEventsAndClearBuffer(
-    std::vector<TraceEvent>& events,
-    std::vector<PerformanceTracerEvent>& buffer,
-    HighResTimeStamp currentTraceEndTime) {
-  for (auto&& event : buffer) {
-    if (isInTracingWindow(currentTraceEndTime, getCreatedAt(event))) {
-      enqueueTraceEventsFromPerformanceTracerEvent(events, std::move(event));
+void PerformanceTracer::unregisterThreadEventBuffer(
+    ThreadEventBuffer& threadEventBuffer) {
+  std::lock_guard lock(mutex_);
+
+  {
+    std::lock_guard threadEventBufferLock(threadEventBuffer.mutex);
+    if (!threadEventBuffer.window.events.empty() ||
+        !threadEventBuffer.altWindow.events.empty()) {
+      // The events are still to be collected when tracing stops.
+      threadEventBuffer.threadExited = true;
+      return;
     }
   }
 
-  buffer.clear();
-  buffer.shrink_to_fit();
+  std::erase_if(threadEventBuffers_, [&](const auto& registeredBuffer) {
+    return registeredBuffer.get() == &threadEventBuffer;
+  });
 }
 
-bool PerformanceTracer::isInTracingWindow(
-    HighResTimeStamp now,
-    HighResTimeStamp timeStampToCheck) const {
-  if (!currentTraceMaxDuration_) {
-    return true;
+PerformanceTracer::ThreadEventBufferRegistration::
+    ~ThreadEventBufferRegistration() {
+  if (threadEventBuffer != nullptr) {
+    PerformanceTracer::getInstance().unregisterThreadEventBuffer(
+        *threadEventBuffer);
   }
+}
+
+const std::string* PerformanceTracer::EventWindow::intern(
+    const std::string& name) {
+  if (auto it = internedNames.find(name); it != internedNames.end()) {
+    return it->second;
+  }
+
+  const auto& internedName = names.emplace_back(name);
+  internedNames.emplace(internedName, &internedName);
+  return &internedName;
+}
 
-  return timeStampToCheck > now - *currentTraceMaxDuration_;
+const std::string* PerformanceTracer::EventWindow::intern(
+    const std::optional<std::string>& name) {
+  return name ? intern(*name) : nullptr;
 }
 
-void PerformanceTracer::enqueueEvent(PerformanceTracerEvent&& event) {
-  if (currentTraceMaxDuration_) {
-    auto createdAt = getCreatedAt(event);
-    // Check if the current buffer is "full"
-    if (createdAt > currentBufferStartTime_ + *currentTraceMaxDuration_) {
-      // We moved past the current buffer. We need to switch the other buffer as
-      // current.
-      previousBuffer_ = currentBuffer_;
-      currentBuffer_ = currentBuffer_ == &buffer_ ? &altBuffer_ : &buffer_;
-      currentBuffer_->clear();
-      currentBufferStartTime_ = createdAt;
+void PerformanceTracer::EventWindow::clear() {
+  events.clear();
+  internedNames.clear();
+  names.clear();
+}
+
+PerformanceTracer::EventWindow&
+PerformanceTracer::ThreadEventBuffer::getCurrentWindow() {
+  if (maxDuration) {
+    auto now = HighResTimeStamp::now();
+    // Check if the current window is "full"
+    if (now > currentWindowStartTime + *maxDuration) {
+      // We moved past the current window. We need to switch the other window
+      // as current, dropping its events along with the names they point to.
+      previousWindow = currentWindow;
+      currentWindow = currentWindow == &window ? &altWindow : &window;
+      currentWindow->clear();
+      currentWindowStartTime = now;
     }
   }
 
-  currentBuffer_->emplace_back(std::move(event));
+  return *currentWindow;
+}
+
+void PerformanceTracer::ThreadEventBuffer::enqueue(
+    PerformanceTracerEvent&& event) {
+  getCurrentWindow().events.emplace_back(std::move(event));
 }
 
-HighResTimeStamp PerformanceTracer::getCreatedAt(
-    const PerformanceTracerEvent& event) const {
+/* static */ HighResTimeStamp PerformanceTracer::getCreatedAt(
+    const PerformanceTracerEvent& event) {
   return std::visit(
       [](const auto& variant) { return variant.createdAt; }, event);
 }
@@ -518,7 +712,8 @@ overloaded(Ts...) -> overloaded<Ts...>;
 
 void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
     std::vector<TraceEvent>& events,
-    PerformanceTracerEvent&& event) {
+    PerformanceTracerEvent&& event,
+    TraceEventConversionState& conversionState) {
   std::visit(
       overloaded{
           [&](PerformanceTracerEventEventLoopTask&& event) {
@@ -556,7 +751,7 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
 
             events.emplace_back(
                 TraceEvent{
-                    .name = std::move(event.name),
+                    .name = *event.name,
                     .cat = "blink.user_timing",
                     .ph = 'I',
                     .ts = event.start,
@@ -572,12 +767,12 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                   folly::dynamic::object("detail", folly::toJson(event.detail));
             }
 
-            auto eventId = ++performanceMeasureCount_;
+            auto eventId = ++conversionState.performanceMeasureCount;
 
             events.emplace_back(
                 TraceEvent{
                     .id = eventId,
-                    .name = event.name,
+                    .name = *event.name,
                     .cat = "blink.user_timing",
                     .ph = 'b',
                     .ts = event.start,
@@ -588,7 +783,7 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
             events.emplace_back(
                 TraceEvent{
                     .id = eventId,
-                    .name = std::move(event.name),
+                    .name = *event.name,
                     .cat = "blink.user_timing",
                     .ph = 'e',
                     .ts = event.start + event.duration,
@@ -597,8 +792,8 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                 });
           },
           [&](PerformanceTracerEventTimeStamp&& event) {
-            folly::dynamic data = folly::dynamic::object("name", event.name)(
-                "message", std::move(event.name));
+            folly::dynamic data = folly::dynamic::object("name", *event.name)(
+                "message", *event.name);
             if (event.start) {
               if (std::holds_alternative<HighResTimeStamp>(*event.start)) {
                 data["start"] = highResTimeStampToTracingClockTimeStamp(
@@ -619,10 +814,10 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
             // We add a custom synthetic entry here to manually put Components
             // track right under the Scheduler track. Will be removed once CDT
             // Frontend preserves track ordering and we upgrade the fork.
-            if (!alreadyEmittedEntryForComponentsTrackOrdering_ &&
-                event.trackName && !event.trackGroup) {
+            if (!conversionState.alreadyEmittedEntryForComponentsTrackOrdering &&
+                event.trackName != nullptr && event.trackGroup == nullptr) {
               if (*event.trackName == "Components \u269B") {
-                alreadyEmittedEntryForComponentsTrackOrdering_ = true;
+                conversionState.alreadyEmittedEntryForComponentsTrackOrdering = true;
                 // React is using 0.003 for Scheduler sub-tracks.
                 auto timestamp = highResTimeStampToTracingClockTimeStamp(
                     HighResTimeStamp::fromDOMHighResTimeStamp(0.004));
@@ -644,11 +839,11 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
               }
             }
 
-            if (event.trackName) {
-              data["track"] = std::move(*event.trackName);
+            if (event.trackName != nullptr) {
+              data["track"] = *event.trackName;
             }
-            if (event.trackGroup) {
-              data["trackGroup"] = std::move(*event.trackGroup);
+            if (event.trackGroup != nullptr) {
+              data["trackGroup"] = *event.trackGroup;
             }
             if (event.color) {
               data["color"] = consoleTimeStampColorToString(*event.color);
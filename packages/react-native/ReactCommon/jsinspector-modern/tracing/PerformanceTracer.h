@@ -15,10 +15,15 @@
 
 #include <folly/dynamic.h>
 #include <atomic>
+#include <deque>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
 #include <vector>
 
 namespace facebook::react::jsinspector_modern::tracing {
@@ -53,6 +58,15 @@ class PerformanceTracer {
    */
   std::optional<std::vector<TraceEvent>> stopTracing();
 
+  /**
+   * If there is a current tracing session, it stops tracing and serializes
+   * the collected events straight from the recording buffers into JSON arrays
+   * of at most \p chunkSize events, which are passed to \p chunkCallback as
+   * soon as they are complete. The callback is called without holding any
+   * lock of the tracer. Returns `false` if not tracing.
+   */
+  bool stopTracing(const std::function<void(std::string &&eventsChunk)> &chunkCallback, uint16_t chunkSize);
+
   /**
    * Returns whether the tracer is currently tracing. This can be useful to
    * avoid doing expensive work (like formatting strings) if tracing is not
@@ -215,6 +229,9 @@ class PerformanceTracer {
 
 #pragma mark - Internal trace event types
 
+  // Names of the events point to strings interned by the window of the thread
+  // buffer that recorded them (see `EventWindow::intern`).
+
   struct PerformanceTracerEventEventLoopTask {
     HighResTimeStamp start;
     HighResTimeStamp end;
@@ -230,7 +247,7 @@ class PerformanceTracer {
   };
 
   struct PerformanceTracerEventMark {
-    std::string name;
+    const std::string *name;
     HighResTimeStamp start;
     folly::dynamic detail;
     ThreadId threadId;
@@ -238,7 +255,7 @@ class PerformanceTracer {
   };
 
   struct PerformanceTracerEventMeasure {
-    std::string name;
+    const std::string *name;
     HighResTimeStamp start;
     HighResDuration duration;
     folly::dynamic detail;
@@ -247,11 +264,11 @@ class PerformanceTracer {
   };
 
   struct PerformanceTracerEventTimeStamp {
-    std::string name;
+    const std::string *name;
     std::optional<ConsoleTimeStampEntry> start;
     std::optional<ConsoleTimeStampEntry> end;
-    std::optional<std::string> trackName;
-    std::optional<std::string> trackGroup;
+    const std::string *trackName;
+    const std::string *trackGroup;
     std::optional<ConsoleTimeStampColor> color;
     std::optional<folly::dynamic> detail;
     ThreadId threadId;
@@ -300,6 +317,81 @@ class PerformanceTracer {
       PerformanceTracerResourceReceiveResponse,
       PerformanceTracerResourceFinish>;
 
+  /**
+   * Events recorded by a thread during a tracing window, with the names they
+   * point to. The names are released together with the events.
+   */
+  struct EventWindow {
+    std::vector<PerformanceTracerEvent> events;
+    std::deque<std::string> names;
+    std::unordered_map<std::string_view, const std::string *> internedNames;
+
+    const std::string *intern(const std::string &name);
+    const std::string *intern(const std::optional<std::string> &name);
+    void clear();
+  };
+
+  /**
+   * The events recorded by a single thread. Only that thread appends to it, so
+   * its mutex is only contended when tracing starts or stops, and recording
+   * does not allocate once the vectors have grown and the names are interned
+   * in the current window.
+   */
+  struct ThreadEventBuffer {
+    std::mutex mutex;
+
+    std::optional<HighResDuration> maxDuration;
+    EventWindow window;
+    // These fields are only used when setting a max duration on the trace.
+    EventWindow altWindow;
+    EventWindow *currentWindow = &window;
+    EventWindow *previousWindow{};
+    HighResTimeStamp currentWindowStartTime;
+
+    // Set when the thread exits before its events were collected. The buffer
+    // is removed once they are.
+    bool threadExited{false};
+
+    /**
+     * Returns the window in which events created now are recorded, switching
+     * windows first if the current one is full.
+     */
+    EventWindow &getCurrentWindow();
+    void enqueue(PerformanceTracerEvent &&event);
+  };
+
+  /**
+   * The windows taken out of the buffer of a thread when tracing stops.
+   */
+  struct ThreadEventRecording {
+    // Only set when a max duration is set on the trace and the windows of the
+    // thread were switched.
+    EventWindow previousWindow;
+    EventWindow currentWindow;
+  };
+
+  /**
+   * State kept while converting the events of a single trace.
+   */
+  struct TraceEventConversionState {
+    // The counter for recorded User Timing "measure" events. Used for
+    // generating unique IDs for each measure event inside a specific Trace.
+    uint32_t performanceMeasureCount{0};
+    // A flag that is used to ensure we only emit one auxiliary entry for the
+    // ordering of Scheduler / Component tracks.
+    bool alreadyEmittedEntryForComponentsTrackOrdering{false};
+  };
+
+  /**
+   * Owns the registration of the buffer of a thread, and unregisters it when
+   * the thread exits.
+   */
+  struct ThreadEventBufferRegistration {
+    ThreadEventBuffer *threadEventBuffer{};
+
+    ~ThreadEventBufferRegistration();
+  };
+
 #pragma mark - Private fields and methods
 
   const ProcessId processId_;
@@ -307,34 +399,19 @@ class PerformanceTracer {
   /**
    * The flag is atomic in order to enable any thread to read it (via
    * isTracing()) without holding the mutex.
-   * Within this class, both reads and writes MUST be protected by the mutex to
-   * avoid false positives and data races.
+   * Writes MUST be protected by the mutex. Events are recorded only if the
+   * flag is still set once the mutex of the thread's buffer is held, since
+   * buffers are drained under their mutex after the flag is reset.
    */
   std::atomic<bool> tracingAtomic_{false};
-  /**
-   * The counter for recorded User Timing "measure" events.
-   * Used for generating unique IDs for each measure event inside a specific
-   * Trace.
-   * Does not need to be atomic, because it is always accessed within the mutex
-   * lock.
-   */
-  uint32_t performanceMeasureCount_{0};
-
   HighResTimeStamp currentTraceStartTime_;
 
   std::optional<HighResDuration> currentTraceMaxDuration_;
 
-  std::vector<PerformanceTracerEvent> buffer_;
-
-  // These fields are only used when setting a max duration on the trace.
-  std::vector<PerformanceTracerEvent> altBuffer_;
-  std::vector<PerformanceTracerEvent> *currentBuffer_ = &buffer_;
-  std::vector<PerformanceTracerEvent> *previousBuffer_{};
-  HighResTimeStamp currentBufferStartTime_;
-
-  // A flag that is used to ensure we only emit one auxiliary entry for the
-  // ordering of Scheduler / Component tracks.
-  bool alreadyEmittedEntryForComponentsTrackOrdering_ = false;
+  // The buffers of all threads that recorded events, protected by the mutex.
+  // Buffers of threads that exited are kept until their events are collected
+  // when tracing stops.
+  std::vector<std::unique_ptr<ThreadEventBuffer>> threadEventBuffers_;
 
   /**
    * Protects data members of this class for concurrent access, including
@@ -347,18 +424,24 @@ class PerformanceTracer {
   uint32_t nextCallbackId_{0};
 
   bool startTracingImpl(std::optional<HighResDuration> maxDuration = std::nullopt);
+  bool stopTracingImpl(const std::function<void(TraceEvent &&event)> &eventCallback);
 
-  std::vector<TraceEvent> collectEventsAndClearBuffers(HighResTimeStamp currentTraceEndTime);
-  void collectEventsAndClearBuffer(
-      std::vector<TraceEvent> &events,
-      std::vector<PerformanceTracerEvent> &buffer,
-      HighResTimeStamp currentTraceEndTime);
-  bool isInTracingWindow(HighResTimeStamp now, HighResTimeStamp timeStampToCheck) const;
-  void enqueueEvent(PerformanceTracerEvent &&event);
+  ThreadEventBuffer &getThreadEventBuffer();
+  void unregisterThreadEventBuffer(ThreadEventBuffer &threadEventBuffer);
 
-  HighResTimeStamp getCreatedAt(const PerformanceTracerEvent &event) const;
+  std::vector<ThreadEventRecording> takeThreadEventRecordings();
+  void collectEvents(
+      std::vector<ThreadEventRecording> &&recordings,
+      HighResTimeStamp currentTraceEndTime,
+      std::optional<HighResDuration> currentTraceMaxDuration,
+      const std::function<void(TraceEvent &&event)> &eventCallback);
 
-  void enqueueTraceEventsFromPerformanceTracerEvent(std::vector<TraceEvent> &events, PerformanceTracerEvent &&event);
+  static HighResTimeStamp getCreatedAt(const PerformanceTracerEvent &event);
+
+  void enqueueTraceEventsFromPerformanceTracerEvent(
+      std::vector<TraceEvent> &events,
+      PerformanceTracerEvent &&event,
+      TraceEventConversionState &conversionState);
 };
 
 } // namespace facebook::react::jsinspector_modern::tracing
@@ -10,8 +10,30 @@
 
 #include <react/timing/primitives.h>
 
+#include <folly/json.h>
+
+#include <array>
+#include <charconv>
+#include <string_view>
+
 namespace facebook::react::jsinspector_modern::tracing {
 
+namespace {
+
+template <typename T>
+void appendNumber(std::string& json, T value) {
+  std::array<char, 24> buffer{};
+  auto result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  json.append(buffer.data(), result.ptr);
+}
+
+void appendString(std::string& json, std::string_view value) {
+  folly::json::escapeString(value, json, folly::json::serialization_opts());
+}
+
+} // namespace
+
 /* static */ folly::dynamic TraceEventSerializer::serialize(
     TraceEvent&& event) {
   folly::dynamic result = folly::dynamic::object;
@@ -38,6 +60,43 @@ namespace facebook::react::jsinspector_modern::tracing {
   return result;
 }
 
+/* static */ void TraceEventSerializer::serializeToJson(
+    const TraceEvent& event,
+    std::string& json) {
+  json.push_back('{');
+  if (event.id.has_value()) {
+    std::array<char, 16> buffer{};
+    snprintf(buffer.data(), buffer.size(), "0x%x", event.id.value());
+    json.append("\"id\":");
+    appendString(json, buffer.data());
+    json.push_back(',');
+  }
+  json.append("\"name\":");
+  appendString(json, event.name);
+  json.append(",\"cat\":");
+  appendString(json, event.cat);
+  json.append(",\"ph\":");
+  appendString(json, std::string_view(&event.ph, 1));
+  json.append(",\"ts\":");
+  appendNumber(json, highResTimeStampToTracingClockTimeStamp(event.ts));
+  json.append(",\"pid\":");
+  appendNumber(json, event.pid);
+  if (event.s.has_value()) {
+    json.append(",\"s\":");
+    appendString(json, std::string_view(&event.s.value(), 1));
+  }
+  json.append(",\"tid\":");
+  appendNumber(json, event.tid);
+  json.append(",\"args\":");
+  json.append(folly::toJson(event.args));
+  if (event.dur.has_value()) {
+    json.append(",\"dur\":");
+    appendNumber(
+        json, highResDurationToTracingClockDuration(event.dur.value()));
+  }
+  json.push_back('}');
+}
+
 /* static */ folly::dynamic TraceEventSerializer::serializeProfileChunk(
     TraceEventProfileChunk&& profileChunk) {
   return folly::dynamic::object(
@@ -11,6 +11,7 @@
 #include "TraceEventProfile.h"
 
 #include <folly/dynamic.h>
+#include <string>
 
 namespace facebook::react::jsinspector_modern::tracing {
 
@@ -30,6 +31,16 @@ class TraceEventSerializer {
    */
   static folly::dynamic serialize(TraceEvent &&event);
 
+  /**
+   * Serializes a TraceEvent to JSON, without building a folly::dynamic object
+   * for the event itself. Only its "args" are serialized through
+   * folly::dynamic.
+   *
+   * \param event The TraceEvent object.
+   * \param json The string that the JSON object is appended to.
+   */
+  static void serializeToJson(const TraceEvent &event, std::string &json);
+
   /**
    * Serialize a TraceEventProfileChunk to a folly::dynamic object.
    *
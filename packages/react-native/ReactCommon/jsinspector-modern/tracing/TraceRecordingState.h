@@ -14,6 +14,8 @@
 #include <oscompat/OSCompat.h>
 #include <react/timing/primitives.h>
 
+#include <functional>
+#include <string_view>
 #include <vector>
 
 namespace facebook::react::jsinspector_modern::tracing {
@@ -34,6 +36,12 @@ struct TraceRecordingState {
 
   // All captures Instance Tracing Profiles during this Trace Recording.
   std::vector<InstanceTracingProfile> instanceTracingProfiles{};
+
+  // Only set while the recording is being stopped. If set, the Trace Events
+  // of the PerformanceTracer are passed here as chunks of JSON arrays as soon
+  // as they are serialized, instead of being kept in the Instance Tracing
+  // Profiles.
+  std::function<void(std::string_view chunk)> performanceTraceEventsChunkCallback{};
 };
 
 } // namespace facebook::react::jsinspector_modern::tracing
@@ -7,62 +7,32 @@
 
 #include "TraceRecordingStateSerializer.h"
 #include "RuntimeSamplingProfileTraceEventSerializer.h"
-#include "TraceEventSerializer.h"
 
-namespace facebook::react::jsinspector_modern::tracing {
-
-namespace {
-
-folly::dynamic generateNewChunk(uint16_t chunkSize) {
-  folly::dynamic chunk = folly::dynamic::array();
-  chunk.reserve(chunkSize);
-
-  return chunk;
-}
+#include <folly/json.h>
 
-} // namespace
+namespace facebook::react::jsinspector_modern::tracing {
 
 /* static */ void TraceRecordingStateSerializer::emitAsDataCollectedChunks(
     TraceRecordingState&& recording,
-    const std::function<void(folly::dynamic&&)>& chunkCallback,
-    uint16_t performanceTraceEventsChunkSize,
+    const std::function<void(std::string_view)>& chunkCallback,
     uint16_t profileTraceEventsChunkSize) {
   auto instancesProfiles = std::move(recording.instanceTracingProfiles);
   IdGenerator profileIdGenerator;
 
   for (auto& instanceProfile : instancesProfiles) {
-    emitPerformanceTraceEvents(
-        std::move(instanceProfile.performanceTraceEvents),
-        chunkCallback,
-        performanceTraceEventsChunkSize);
+    for (auto& chunk : instanceProfile.performanceTraceEventChunks) {
+      chunkCallback(chunk);
+      // Sent chunks are released right away.
+      chunk = std::string();
+    }
   }
 
   RuntimeSamplingProfileTraceEventSerializer::serializeAndDispatch(
       std::move(recording.runtimeSamplingProfiles),
       profileIdGenerator,
       recording.startTime,
-      chunkCallback,
+      [&](folly::dynamic&& chunk) { chunkCallback(folly::toJson(chunk)); },
       profileTraceEventsChunkSize);
 }
 
-/* static */ void TraceRecordingStateSerializer::emitPerformanceTraceEvents(
-    std::vector<TraceEvent>&& events,
-    const std::function<void(folly::dynamic&&)>& chunkCallback,
-    uint16_t chunkSize) {
-  folly::dynamic chunk = generateNewChunk(chunkSize);
-
-  for (auto& event : events) {
-    if (chunk.size() == chunkSize) {
-      chunkCallback(std::move(chunk));
-      chunk = generateNewChunk(chunkSize);
-    }
-
-    chunk.push_back(TraceEventSerializer::serialize(std::move(event)));
-  }
-
-  if (!chunk.empty()) {
-    chunkCallback(std::move(chunk));
-  }
-}
-
 } // namespace facebook::react::jsinspector_modern::tracing
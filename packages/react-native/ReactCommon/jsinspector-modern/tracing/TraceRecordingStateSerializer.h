@@ -7,11 +7,10 @@
 
 #pragma once
 
-#include "TraceEvent.h"
 #include "TraceRecordingState.h"
 
-#include <folly/dynamic.h>
-#include <vector>
+#include <functional>
+#include <string_view>
 
 namespace facebook::react::jsinspector_modern::tracing {
 
@@ -23,20 +22,16 @@ class TraceRecordingStateSerializer {
  public:
   /**
    * Transforms the recording into a sequence of serialized Trace Events, which
-   * is split in chunks of sizes \p performanceTraceEventsChunkSize or
-   * \p profileTraceEventsChunkSize, depending on type, and sent with \p
-   * chunkCallback.
+   * is split in chunks and sent with \p chunkCallback as JSON arrays. The
+   * chunks of Performance Trace Events are sent as serialized when tracing
+   * stopped, and chunks of Profile Trace Events are of size
+   * \p profileTraceEventsChunkSize. Only a single chunk is serialized at a
+   * time, and sent chunks are released.
    */
   static void emitAsDataCollectedChunks(
       TraceRecordingState &&recording,
-      const std::function<void(folly::dynamic &&chunk)> &chunkCallback,
-      uint16_t performanceTraceEventsChunkSize,
+      const std::function<void(std::string_view chunk)> &chunkCallback,
       uint16_t profileTraceEventsChunkSize);
-
-  static void emitPerformanceTraceEvents(
-      std::vector<TraceEvent> &&events,
-      const std::function<void(folly::dynamic &&chunk)> &chunkCallback,
-      uint16_t chunkSize);
 };
 
 } // namespace facebook::react::jsinspector_modern::tracing
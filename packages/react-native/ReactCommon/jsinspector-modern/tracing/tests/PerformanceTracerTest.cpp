@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PerformanceTracer.h"
+
+#include <folly/json.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace facebook::react::jsinspector_modern::tracing {
+
+namespace {
+
+std::vector<std::string> getNamesOfEvents(
+    const std::vector<TraceEvent>& events,
+    char phase) {
+  std::vector<std::string> names;
+  for (const auto& event : events) {
+    if (event.cat == "blink.user_timing" && event.ph == phase) {
+      names.push_back(event.name);
+    }
+  }
+  return names;
+}
+
+} // namespace
+
+TEST(PerformanceTracerTest, DoesNotRecordEventsWhenNotTracing) {
+  auto& tracer = PerformanceTracer::getInstance();
+  tracer.reportMark("ignored", HighResTimeStamp::now());
+
+  EXPECT_TRUE(tracer.startTracing());
+  auto events = tracer.stopTracing();
+
+  ASSERT_TRUE(events.has_value());
+  EXPECT_THAT(getNamesOfEvents(*events, 'I'), ::testing::IsEmpty());
+  EXPECT_FALSE(tracer.stopTracing().has_value());
+}
+
+TEST(PerformanceTracerTest, MergesEventsOfAllThreadsInOrder) {
+  auto& tracer = PerformanceTracer::getInstance();
+  EXPECT_TRUE(tracer.startTracing());
+
+  tracer.reportMark("first", HighResTimeStamp::now());
+  std::thread([&]() {
+    tracer.reportMark("second", HighResTimeStamp::now());
+  }).join();
+  tracer.reportMark("third", HighResTimeStamp::now());
+  std::thread([&]() {
+    tracer.reportMark("fourth", HighResTimeStamp::now());
+  }).join();
+
+  auto events = tracer.stopTracing();
+  ASSERT_TRUE(events.has_value());
+  EXPECT_THAT(
+      getNamesOfEvents(*events, 'I'),
+      ::testing::ElementsAre("first", "second", "third", "fourth"));
+}
+
+TEST(PerformanceTracerTest, CollectsEventsOfExitedThreadsOnce) {
+  auto& tracer = PerformanceTracer::getInstance();
+
+  // Threads that exit without recording anything don't keep a buffer.
+  std::thread([&]() {
+    tracer.reportMark("ignored", HighResTimeStamp::now());
+  }).join();
+
+  EXPECT_TRUE(tracer.startTracing());
+  std::thread([&]() {
+    tracer.reportMark("exited", HighResTimeStamp::now());
+  }).join();
+  auto events = tracer.stopTracing();
+  ASSERT_TRUE(events.has_value());
+  EXPECT_THAT(getNamesOfEvents(*events, 'I'), ::testing::ElementsAre("exited"));
+
+  EXPECT_TRUE(tracer.startTracing());
+  events = tracer.stopTracing();
+  ASSERT_TRUE(events.has_value());
+  EXPECT_THAT(getNamesOfEvents(*events, 'I'), ::testing::IsEmpty());
+}
+
+TEST(PerformanceTracerTest, KeepsInternedNamesAcrossTraces) {
+  auto& tracer = PerformanceTracer::getInstance();
+  auto start = HighResTimeStamp::now();
+  auto duration = HighResDuration::fromMilliseconds(1);
+
+  for (auto i = 0; i < 2; i++) {
+    EXPECT_TRUE(tracer.startTracing());
+    tracer.reportMeasure("measure", start, duration);
+    tracer.reportMeasure("measure", start, duration);
+    tracer.reportTimeStamp(
+        "timeStamp", std::nullopt, std::nullopt, "track", "trackGroup");
+
+    auto events = tracer.stopTracing();
+    ASSERT_TRUE(events.has_value());
+    EXPECT_THAT(
+        getNamesOfEvents(*events, 'b'),
+        ::testing::ElementsAre("measure", "measure"));
+
+    auto timeStamp = std::find_if(
+        events->begin(), events->end(), [](const TraceEvent& event) {
+          return event.name == "TimeStamp";
+        });
+    ASSERT_NE(timeStamp, events->end());
+    EXPECT_EQ(timeStamp->args["data"]["name"], "timeStamp");
+    EXPECT_EQ(timeStamp->args["data"]["track"], "track");
+    EXPECT_EQ(timeStamp->args["data"]["trackGroup"], "trackGroup");
+  }
+}
+
+TEST(PerformanceTracerTest, KeepsNamesOfEventsInTheTracingWindow) {
+  auto& tracer = PerformanceTracer::getInstance();
+  auto sleep = []() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+  };
+
+  EXPECT_TRUE(tracer.startTracing(HighResDuration::fromMilliseconds(1000)));
+  tracer.reportMark("expired", HighResTimeStamp::now());
+  sleep();
+  tracer.reportMark("repeated", HighResTimeStamp::now());
+  sleep();
+  // Switches to the second window, which interns the names again.
+  tracer.reportMark("previous", HighResTimeStamp::now());
+  sleep();
+  tracer.reportMark("repeated", HighResTimeStamp::now());
+  sleep();
+  // Switches back to the first window, dropping its events and names.
+  tracer.reportMark("current", HighResTimeStamp::now());
+
+  auto events = tracer.stopTracing();
+  ASSERT_TRUE(events.has_value());
+  EXPECT_THAT(
+      getNamesOfEvents(*events, 'I'),
+      ::testing::ElementsAre("repeated", "current"));
+}
+
+TEST(PerformanceTracerTest, SerializesEventsInChunks) {
+  auto& tracer = PerformanceTracer::getInstance();
+  EXPECT_TRUE(tracer.startTracing());
+
+  for (auto i = 0; i < 5; i++) {
+    tracer.reportMark("mark" + std::to_string(i), HighResTimeStamp::now());
+  }
+
+  std::vector<folly::dynamic> chunks;
+  EXPECT_TRUE(tracer.stopTracing(
+      [&](std::string&& eventsChunk) {
+        chunks.push_back(folly::parseJson(eventsChunk));
+      },
+      2));
+  EXPECT_FALSE(tracer.stopTracing([](std::string&&) { FAIL(); }, 2));
+
+  std::vector<std::string> names;
+  for (size_t i = 0; i < chunks.size(); i++) {
+    ASSERT_TRUE(chunks[i].isArray());
+    if (i + 1 < chunks.size()) {
+      EXPECT_EQ(chunks[i].size(), 2);
+    }
+    for (const auto& event : chunks[i]) {
+      if (event["cat"] == "blink.user_timing") {
+        names.push_back(event["name"].getString());
+      }
+    }
+  }
+  EXPECT_THAT(
+      names,
+      ::testing::ElementsAre("mark0", "mark1", "mark2", "mark3", "mark4"));
+}
+
+TEST(PerformanceTracerTest, CallsChunkCallbackWithoutHoldingTheLock) {
+  auto& tracer = PerformanceTracer::getInstance();
+  EXPECT_TRUE(tracer.startTracing());
+  tracer.reportMark("mark", HighResTimeStamp::now());
+
+  auto chunkCount = 0;
+  EXPECT_TRUE(tracer.stopTracing(
+      [&](std::string&& /*eventsChunk*/) {
+        // Subscribing locks the tracer, which would deadlock if the events were
+        // serialized under its lock.
+        auto subscriptionId =
+            tracer.subscribeToTracingStateChanges([](bool /*isTracing*/) {});
+        tracer.unsubscribeFromTracingStateChanges(subscriptionId);
+        chunkCount++;
+      },
+      1));
+  EXPECT_GT(chunkCount, 0);
+}
+
+} // namespace facebook::react::jsinspector_modern::tracing
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsinspector-modern/tracing/TraceEventSerializer.h>
+
+#include <folly/json.h>
+#include <gtest/gtest.h>
+
+namespace facebook::react::jsinspector_modern::tracing {
+
+namespace {
+
+TraceEvent createTraceEvent() {
+  return TraceEvent{
+      .name = "measure \"quoted\"\n",
+      .cat = "blink.user_timing",
+      .ph = 'X',
+      .ts = HighResTimeStamp::now(),
+      .pid = 1000,
+      .tid = 1001,
+      .args = folly::dynamic::object(
+          "data", folly::dynamic::object("detail", "{\"key\": 1}")),
+  };
+}
+
+} // namespace
+
+TEST(TraceEventSerializerTest, SerializesToSameJsonAsDynamic) {
+  auto event = createTraceEvent();
+  event.id = 0xff;
+  event.s = 't';
+  event.dur = HighResDuration::fromMilliseconds(2);
+
+  std::string json;
+  TraceEventSerializer::serializeToJson(event, json);
+
+  EXPECT_EQ(
+      folly::parseJson(json), TraceEventSerializer::serialize(std::move(event)));
+}
+
+TEST(TraceEventSerializerTest, SerializesToJsonWithoutOptionalFields) {
+  auto event = createTraceEvent();
+
+  std::string json = "[";
+  TraceEventSerializer::serializeToJson(event, json);
+  json.push_back(']');
+
+  auto serializedEvents = folly::parseJson(json);
+  ASSERT_EQ(serializedEvents.size(), 1);
+  EXPECT_EQ(
+      serializedEvents[0], TraceEventSerializer::serialize(std::move(event)));
+  EXPECT_EQ(serializedEvents[0].count("id"), 0);
+  EXPECT_EQ(serializedEvents[0].count("s"), 0);
+  EXPECT_EQ(serializedEvents[0].count("dur"), 0);
+}
+
+} // namespace facebook::react::jsinspector_modern::tracing
@@ -34,6 +34,9 @@
 #include <react/renderer/animated/nodes/TransformAnimatedNode.h>
 #include <react/renderer/animated/nodes/ValueAnimatedNode.h>
 #include <react/renderer/core/EventEmitter.h>
+#include <algorithm>
+#include <limits>
+#include <numeric>
 
 #ifdef RN_USE_ANIMATION_BACKEND
 #include <react/renderer/animationbackend/AnimatedPropsBuilder.h>
@@ -50,10 +53,19 @@ void g_setNativeAnimatedNowTimestampFunction(TimePointFunction nowFunction) {
 
 namespace {
 
-struct NodesQueueItem {
-  AnimatedNode* node;
-  bool connectedToFinishedAnimation;
-};
+// Per-frame state of a node in `EvaluationOrder`.
+constexpr uint8_t NodeIsActive = 1 << 0;
+constexpr uint8_t NodeIsConnectedToFinishedAnimation = 1 << 1;
+
+void updateNode(AnimatedNode* node, bool connectedToFinishedAnimation) {
+  if (connectedToFinishedAnimation && node->type() == AnimatedNodeType::Props) {
+    if (auto propsNode = dynamic_cast<PropsAnimatedNode*>(node)) {
+      propsNode->update(/*forceFabricCommit*/ true);
+    }
+  } else {
+    node->update();
+  }
+}
 
 void mergeObjects(folly::dynamic& out, const folly::dynamic& objectToMerge) {
   react_native_assert(objectToMerge.isObject());
@@ -66,6 +78,72 @@ void mergeObjects(folly::dynamic& out, const folly::dynamic& objectToMerge) {
   }
 }
 
+// Sets `out` to the contents of `object`, reusing the storage of `out` for
+// the keys they share.
+void assignObject(folly::dynamic& out, const folly::dynamic& object) {
+  react_native_assert(object.isObject());
+  if (!out.isObject()) {
+    out = object;
+    return;
+  }
+  for (auto it = out.items().begin(); it != out.items().end();) {
+    if (object.count(it->first) == 0) {
+      it = out.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (const auto& pair : object.items()) {
+    out[pair.first] = pair.second;
+  }
+}
+
+using ViewPropsMap = std::unordered_map<Tag, folly::dynamic>;
+
+// Merges `props` into the props of the view in `viewProps`. The first update
+// of a view since the last commit takes an entry released by that commit,
+// preferably the one of the same view, instead of allocating a new one.
+void mergeViewProps(
+    ViewPropsMap& viewProps,
+    std::vector<ViewPropsMap::node_type>& releasedViewProps,
+    Tag viewTag,
+    const folly::dynamic& props) {
+  if (auto it = viewProps.find(viewTag); it != viewProps.end()) {
+    mergeObjects(it->second, props);
+    return;
+  }
+
+  if (releasedViewProps.empty()) {
+    viewProps.emplace(viewTag, props);
+    return;
+  }
+
+  auto released = std::find_if(
+      releasedViewProps.begin(),
+      releasedViewProps.end(),
+      [&](const ViewPropsMap::node_type& node) {
+        return node.key() == viewTag;
+      });
+  if (released != releasedViewProps.end()) {
+    std::swap(*released, releasedViewProps.back());
+  }
+  auto node = std::move(releasedViewProps.back());
+  releasedViewProps.pop_back();
+
+  node.key() = viewTag;
+  assignObject(node.mapped(), props);
+  viewProps.insert(std::move(node));
+}
+
+// Empties `viewProps`, keeping its entries for the next frame.
+void releaseViewProps(
+    ViewPropsMap& viewProps,
+    std::vector<ViewPropsMap::node_type>& releasedViewProps) {
+  while (!viewProps.empty()) {
+    releasedViewProps.push_back(viewProps.extract(viewProps.begin()));
+  }
+}
+
 } // namespace
 
 thread_local bool NativeAnimatedNodesManager::isOnRenderThread_{false};
@@ -208,6 +286,7 @@ void NativeAnimatedNodesManager::connectAnimatedNodes(
 
   if ((parentNode != nullptr) && (childNode != nullptr)) {
     parentNode->addChild(childTag);
+    isEvaluationOrderValid_ = false;
     updatedNodeTags_.insert(childTag);
   } else {
     LOG(WARNING) << "Cannot ConnectAnimatedNodes, parentTag = " << parentTag
@@ -269,6 +348,7 @@ void NativeAnimatedNodesManager::disconnectAnimatedNodes(
 
   if ((parentNode != nullptr) && (childNode != nullptr)) {
     parentNode->removeChild(childTag);
+    isEvaluationOrderValid_ = false;
   } else {
     LOG(WARNING) << "Cannot DisconnectAnimatedNodes, parentTag = " << parentTag
                  << ", childTag = " << childTag
@@ -284,7 +364,9 @@ void NativeAnimatedNodesManager::restoreDefaultValues(Tag tag) noexcept {
 
 void NativeAnimatedNodesManager::dropAnimatedNode(Tag tag) noexcept {
   std::lock_guard<std::mutex> lock(connectedAnimatedNodesMutex_);
-  animatedNodes_.erase(tag);
+  if (animatedNodes_.erase(tag) != 0u) {
+    isEvaluationOrderValid_ = false;
+  }
 }
 
 #pragma mark - Mutations
@@ -577,185 +659,229 @@ bool NativeAnimatedNodesManager::isAnimationUpdateNeeded() const noexcept {
       isEventAnimationInProgress_;
 }
 
-void NativeAnimatedNodesManager::updateNodes(
-    const std::set<int>& finishedAnimationValueNodes) noexcept {
-  auto nodesQueue = std::deque<NodesQueueItem>{};
-
-  const auto is_node_connected_to_finished_animation =
-      [&finishedAnimationValueNodes](
-          AnimatedNode* node,
-          int nodeTag,
-          bool parentFinishedAnimation) -> bool {
-    return parentFinishedAnimation ||
-        (node->type() == AnimatedNodeType::Value &&
-         finishedAnimationValueNodes.contains(nodeTag));
-  };
+void NativeAnimatedNodesManager::updateEvaluationOrderIfNeeded() noexcept {
+  if (isEvaluationOrderValid_) {
+    return;
+  }
+  isEvaluationOrderValid_ = true;
 
-#ifdef REACT_NATIVE_DEBUG
-  int activeNodesCount = 0;
-  int updatedNodesCount = 0;
-#endif
+  // Index the nodes in arbitrary order first.
+  auto nodes = std::vector<AnimatedNode*>{};
+  nodes.reserve(animatedNodes_.size());
+  for (const auto& [_tag, node] : animatedNodes_) {
+    node->evaluationOrderIndex = nodes.size();
+    nodes.push_back(node.get());
+  }
 
-  // STEP 1.
-  // BFS over graph of nodes. Update `mIncomingNodes` attribute for each node
-  // during that BFS. Store number of visited nodes in `activeNodesCount`. We
-  // "execute" active animations as a part of this step.
+  auto incomingNodesCounts = std::vector<size_t>(nodes.size(), 0);
+  auto componentRoots = std::vector<size_t>(nodes.size());
+  std::iota(componentRoots.begin(), componentRoots.end(), 0);
+  const auto findComponentRoot = [&componentRoots](size_t index) {
+    while (componentRoots[index] != index) {
+      componentRoots[index] = componentRoots[componentRoots[index]];
+      index = componentRoots[index];
+    }
+    return index;
+  };
 
-  animatedGraphBFSColor_++;
-  if (animatedGraphBFSColor_ == AnimatedNode::INITIAL_BFS_COLOR) {
-    animatedGraphBFSColor_++;
+  for (size_t index = 0; index < nodes.size(); index++) {
+    for (const auto childTag : nodes[index]->getChildren()) {
+      if (auto child = getAnimatedNode<AnimatedNode>(childTag)) {
+        auto childIndex = child->evaluationOrderIndex.value();
+        incomingNodesCounts[childIndex]++;
+        componentRoots[findComponentRoot(childIndex)] =
+            findComponentRoot(index);
+      }
+    }
   }
 
-  for (const auto& nodeTag : updatedNodeTags_) {
-    if (auto node = getAnimatedNode<AnimatedNode>(nodeTag)) {
-      if (node->bfsColor != animatedGraphBFSColor_) {
-        node->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-        activeNodesCount++;
-#endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(node, nodeTag, false);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = node,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
+  // Kahn's algorithm. In Animated, value nodes like RGBA are parents and Color
+  // node is child (the opposite of tree structure), so parents are evaluated
+  // first. Nodes that are part of a cycle, or downstream of one, are left out.
+  auto sortedIndices = std::vector<size_t>{};
+  sortedIndices.reserve(nodes.size());
+  for (size_t index = 0; index < nodes.size(); index++) {
+    if (incomingNodesCounts[index] == 0) {
+      sortedIndices.push_back(index);
+    }
+  }
+  for (size_t i = 0; i < sortedIndices.size(); i++) {
+    for (const auto childTag : nodes[sortedIndices[i]]->getChildren()) {
+      if (auto child = getAnimatedNode<AnimatedNode>(childTag)) {
+        auto childIndex = child->evaluationOrderIndex.value();
+        if (--incomingNodesCounts[childIndex] == 0) {
+          sortedIndices.push_back(childIndex);
+        }
       }
     }
   }
 
-  while (!nodesQueue.empty()) {
-    auto nextNode = nodesQueue.front();
-    nodesQueue.pop_front();
-    // in Animated, value nodes like RGBA are parents and Color node is child
-    // (the opposite of tree structure)
-    for (const auto childTag : nextNode.node->getChildren()) {
-      auto child = getAnimatedNode<AnimatedNode>(childTag);
-      child->activeIncomingNodes++;
-      if (child->bfsColor != animatedGraphBFSColor_) {
-        child->bfsColor = animatedGraphBFSColor_;
 #ifdef REACT_NATIVE_DEBUG
-        activeNodesCount++;
+  // In Fabric there can be race conditions between the JS thread setting up or
+  // tearing down animated nodes, and Fabric executing them on the UI thread,
+  // leading to temporary inconsistent states.
+  if (sortedIndices.size() != nodes.size()) {
+    LOG(ERROR) << "Detected animation cycle. Looks like animated nodes graph "
+               << "has cycles, there are " << nodes.size()
+               << " nodes but toposort visited only " << sortedIndices.size();
+  }
 #endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(
-                child, childTag, nextNode.connectedToFinishedAnimation);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = child,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
+
+  // Group the sorted nodes by component, keeping them in topological order
+  // within each component.
+  auto componentIndices =
+      std::vector<size_t>(nodes.size(), std::numeric_limits<size_t>::max());
+  auto& order = evaluationOrder_;
+  order.componentOffsets.assign(1, 0);
+  for (const auto index : sortedIndices) {
+    auto& componentIndex = componentIndices[findComponentRoot(index)];
+    if (componentIndex == std::numeric_limits<size_t>::max()) {
+      componentIndex = order.componentOffsets.size() - 1;
+      order.componentOffsets.push_back(0);
+    }
+    order.componentOffsets[componentIndex + 1]++;
+  }
+  for (size_t component = 1; component < order.componentOffsets.size();
+       component++) {
+    order.componentOffsets[component] += order.componentOffsets[component - 1];
+  }
+
+  for (auto node : nodes) {
+    node->evaluationOrderIndex.reset();
+  }
+  order.nodes.resize(sortedIndices.size());
+  order.components.resize(sortedIndices.size());
+  auto nextPositions = order.componentOffsets;
+  for (const auto index : sortedIndices) {
+    auto component = componentIndices[findComponentRoot(index)];
+    auto position = nextPositions[component]++;
+    order.nodes[position] = nodes[index];
+    order.components[position] = component;
+    nodes[index]->evaluationOrderIndex = position;
+  }
+
+  order.childrenOffsets.clear();
+  order.children.clear();
+  for (const auto node : order.nodes) {
+    order.childrenOffsets.push_back(order.children.size());
+    for (const auto childTag : node->getChildren()) {
+      if (auto child = getAnimatedNode<AnimatedNode>(childTag);
+          child != nullptr && child->evaluationOrderIndex) {
+        order.children.push_back(child->evaluationOrderIndex.value());
       }
     }
   }
+  order.childrenOffsets.push_back(order.children.size());
 
-  // STEP 2
-  // BFS over the graph of active nodes in topological order -> visit node only
-  // when all its "predecessors" in the graph have already been visited. It is
-  // important to visit nodes in that order as they may often use values of
-  // their predecessors in order to calculate "next state" of their own. We
-  // start by determining the starting set of nodes by looking for nodes with
-  // `activeIncomingNodes = 0` (those can only be the ones that we start BFS in
-  // the previous step). We store number of visited nodes in this step in
-  // `updatedNodesCount`
+  nodeEvaluationStates_.assign(order.nodes.size(), 0);
+  isComponentUpdated_.assign(order.componentOffsets.size() - 1, false);
+}
 
-  animatedGraphBFSColor_++;
-  if (animatedGraphBFSColor_ == AnimatedNode::INITIAL_BFS_COLOR) {
-    animatedGraphBFSColor_++;
-  }
+void NativeAnimatedNodesManager::updateNodes(
+    const std::set<int>& finishedAnimationValueNodes) noexcept {
+  const auto is_node_connected_to_finished_animation =
+      [&finishedAnimationValueNodes](
+          AnimatedNode* node, bool parentFinishedAnimation) -> bool {
+    return parentFinishedAnimation ||
+        (node->type() == AnimatedNodeType::Value &&
+         finishedAnimationValueNodes.contains(node->tag()));
+  };
 
+  updateEvaluationOrderIfNeeded();
+  const auto& order = evaluationOrder_;
+
+  // STEP 1.
+  // Mark the updated nodes as active, and collect the connected components
+  // they are part of.
+  updatedComponents_.clear();
   for (const auto& nodeTag : updatedNodeTags_) {
-    if (auto node = getAnimatedNode<AnimatedNode>(nodeTag)) {
-      if (node->activeIncomingNodes == 0 &&
-          node->bfsColor != animatedGraphBFSColor_) {
-        node->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-        updatedNodesCount++;
-#endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(node, nodeTag, false);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = node,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
+    auto node = getAnimatedNode<AnimatedNode>(nodeTag);
+    if (node == nullptr) {
+      continue;
+    }
+
+    if (!node->evaluationOrderIndex) {
+      // The node was created after the evaluation order was built and hasn't
+      // been connected since, so it's evaluated on its own.
+      if (node->getChildren().empty()) {
+        updateNode(node, is_node_connected_to_finished_animation(node, false));
       }
+      continue;
     }
-  }
 
-// Run main "update" loop
-#ifdef REACT_NATIVE_DEBUG
-  int cyclesDetected = 0;
-#endif
-  while (!nodesQueue.empty()) {
-    auto nextNode = nodesQueue.front();
-    nodesQueue.pop_front();
-    if (nextNode.connectedToFinishedAnimation &&
-        nextNode.node->type() == AnimatedNodeType::Props) {
-      if (auto propsNode = dynamic_cast<PropsAnimatedNode*>(nextNode.node)) {
-        propsNode->update(/*forceFabricCommit*/ true);
-      };
-    } else {
-      nextNode.node->update();
+    auto index = node->evaluationOrderIndex.value();
+    nodeEvaluationStates_[index] |= NodeIsActive;
+    auto component = order.components[index];
+    if (!isComponentUpdated_[component]) {
+      isComponentUpdated_[component] = true;
+      updatedComponents_.push_back(component);
     }
+  }
 
-    for (auto childTag : nextNode.node->getChildren()) {
-      auto child = getAnimatedNode<AnimatedNode>(childTag);
-      child->activeIncomingNodes--;
-      if (child->activeIncomingNodes == 0 && child->activeIncomingNodes == 0) {
-        child->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-        updatedNodesCount++;
-#endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(
-                child, childTag, nextNode.connectedToFinishedAnimation);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = child,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
+  // STEP 2.
+  // Sweep the updated components in topological order, so that a node is
+  // visited only after all its "predecessors" in the graph. It is important to
+  // visit nodes in that order as they may often use values of their
+  // predecessors in order to calculate "next state" of their own. Updating a
+  // node activates its children.
+  for (const auto component : updatedComponents_) {
+    isComponentUpdated_[component] = false;
+    for (auto index = order.componentOffsets[component];
+         index < order.componentOffsets[component + 1];
+         index++) {
+      auto state = nodeEvaluationStates_[index];
+      if (state == 0) {
+        continue;
       }
-#ifdef REACT_NATIVE_DEBUG
-      else if (child->bfsColor == animatedGraphBFSColor_) {
-        cyclesDetected++;
+      nodeEvaluationStates_[index] = 0;
+
+      auto node = order.nodes[index];
+      const auto connectedToFinishedAnimation =
+          is_node_connected_to_finished_animation(
+              node, (state & NodeIsConnectedToFinishedAnimation) != 0);
+      updateNode(node, connectedToFinishedAnimation);
+
+      auto childState = connectedToFinishedAnimation
+          ? NodeIsActive | NodeIsConnectedToFinishedAnimation
+          : NodeIsActive;
+      for (auto childIndex = order.childrenOffsets[index];
+           childIndex < order.childrenOffsets[index + 1];
+           childIndex++) {
+        nodeEvaluationStates_[order.children[childIndex]] |= childState;
       }
-#endif
     }
   }
 
-#ifdef REACT_NATIVE_DEBUG
-  // Verify that we've visited *all* active nodes. Throw otherwise as this could
-  // mean there is a cycle in animated node graph, or that the graph is only
-  // partially set up. We also take advantage of the fact that all active nodes
-  // are visited in the step above so that all the nodes properties
-  // `activeIncomingNodes` are set to zero. In Fabric there can be race
-  // conditions between the JS thread setting up or tearing down animated nodes,
-  // and Fabric executing them on the UI thread, leading to temporary
-  // inconsistent states.
-  if (activeNodesCount != updatedNodesCount) {
-    if (warnedAboutGraphTraversal_) {
-      return;
+  updatedNodeTags_.clear();
+}
+
+void NativeAnimatedNodesManager::runAnimationSteps(double timestamp) {
+  if constexpr (!AnimationDriverBatch::isVectorized()) {
+    for (const auto& [_id, driver] : activeAnimations_) {
+      driver->runAnimationStep(timestamp);
     }
-    warnedAboutGraphTraversal_ = true;
-    auto reason = cyclesDetected > 0
-        ? ("cycles (" + std::to_string(cyclesDetected) + ")")
-        : "disconnected regions";
-    LOG(ERROR) << "Detected animation cycle or disconnected graph. "
-               << "Looks like animated nodes graph has " << reason
-               << ", there are " << activeNodesCount
-               << " but toposort visited only " << updatedNodesCount;
-  } else {
-    warnedAboutGraphTraversal_ = false;
+    return;
   }
-#endif
 
-  updatedNodeTags_.clear();
+  // Springs add the samples of their curves to the batch, which evaluates
+  // them all at once before the drivers apply the results. Other drivers
+  // update on their own, since their curves are cheaper than the batching.
+  animationDriverBatch_.reset(activeAnimations_.size());
+  for (const auto& [_id, driver] : activeAnimations_) {
+    driver->runAnimationStep(timestamp, animationDriverBatch_);
+  }
+  animationDriverBatch_.evaluate();
+  for (const auto& [_id, driver] : activeAnimations_) {
+    driver->finishAnimationStep(animationDriverBatch_);
+  }
 }
 
 bool NativeAnimatedNodesManager::onAnimationFrame(double timestamp) {
   // Run all active animations
   auto hasFinishedAnimations = false;
   std::set<int> finishedAnimationValueNodes;
+  runAnimationSteps(timestamp);
   for (const auto& [_id, driver] : activeAnimations_) {
-    driver->runAnimationStep(timestamp);
-
     if (driver->getIsComplete()) {
       hasFinishedAnimations = true;
       const auto shouldRemoveJsSync =
@@ -877,9 +1003,10 @@ void NativeAnimatedNodesManager::schedulePropsCommit(
     bool forceFabricCommit) noexcept {
   if (ReactNativeFeatureFlags::useSharedAnimatedBackend()) {
     if (layoutStyleUpdated) {
-      mergeObjects(updateViewProps_[viewTag], props);
+      mergeViewProps(updateViewProps_, releasedViewProps_, viewTag, props);
     } else {
-      mergeObjects(updateViewPropsDirect_[viewTag], props);
+      mergeViewProps(
+          updateViewPropsDirect_, releasedViewPropsDirect_, viewTag, props);
     }
     return;
   }
@@ -892,12 +1019,14 @@ void NativeAnimatedNodesManager::schedulePropsCommit(
   if (fabricCommitCallback_ != nullptr &&
       (layoutStyleUpdated || forceFabricCommit ||
        directManipulationCallback_ == nullptr)) {
-    mergeObjects(updateViewProps_[viewTag], props);
+    mergeViewProps(updateViewProps_, releasedViewProps_, viewTag, props);
 
     // Must call direct manipulation to set final values on components.
-    mergeObjects(updateViewPropsDirect_[viewTag], props);
+    mergeViewProps(
+        updateViewPropsDirect_, releasedViewPropsDirect_, viewTag, props);
   } else if (!layoutStyleUpdated && directManipulationCallback_ != nullptr) {
-    mergeObjects(updateViewPropsDirect_[viewTag], props);
+    mergeViewProps(
+        updateViewPropsDirect_, releasedViewPropsDirect_, viewTag, props);
     if (!ReactNativeFeatureFlags::
             overrideBySynchronousMountPropsAtMountingAndroid()) {
       std::lock_guard<std::mutex> lock(unsyncedDirectViewPropsMutex_);
@@ -945,9 +1074,8 @@ AnimationMutations NativeAnimatedNodesManager::pullAnimationMutations() {
       // Run all active animations
       auto hasFinishedAnimations = false;
       std::set<int> finishedAnimationValueNodes;
+      runAnimationSteps(timestamp);
       for (const auto& [_id, driver] : activeAnimations_) {
-        driver->runAnimationStep(timestamp);
-
         if (driver->getIsComplete()) {
           hasFinishedAnimations = true;
           const auto shouldRemoveJsSync =
@@ -1121,15 +1249,15 @@ bool NativeAnimatedNodesManager::commitProps() {
     }
   }
 
-  updateViewProps_.clear();
+  releaseViewProps(updateViewProps_, releasedViewProps_);
 
   if (directManipulationCallback_ != nullptr) {
     for (const auto& [viewTag, props] : updateViewPropsDirect_) {
-      directManipulationCallback_(viewTag, folly::dynamic(props));
+      directManipulationCallback_(viewTag, props);
     }
   }
 
-  updateViewPropsDirect_.clear();
+  releaseViewProps(updateViewPropsDirect_, releasedViewPropsDirect_);
 
   return containsChange;
 }
@@ -16,6 +16,7 @@
 #include <react/bridging/Function.h>
 #include <react/debug/flags.h>
 #include <react/renderer/animated/EventEmitterListener.h>
+#include <react/renderer/animated/drivers/AnimationDriverBatch.h>
 #include <react/renderer/animated/event_drivers/EventAnimationDriver.h>
 #ifdef RN_USE_ANIMATION_BACKEND
 #include <react/renderer/animationbackend/AnimationBackend.h>
@@ -190,6 +191,8 @@ class NativeAnimatedNodesManager {
 
   bool onAnimationFrame(double timestamp);
 
+  void runAnimationSteps(double timestamp);
+
   bool isAnimationUpdateNeeded() const noexcept;
 
   void stopAnimationsForNode(Tag nodeTag);
@@ -198,6 +201,8 @@ class NativeAnimatedNodesManager {
 
   void handleAnimatedEvent(Tag tag, const std::string &eventName, const EventPayload &payload) noexcept;
 
+  void updateEvaluationOrderIfNeeded() noexcept;
+
   std::weak_ptr<UIManagerAnimationBackend> animationBackend_;
 
   std::unique_ptr<AnimatedNode> animatedNode(Tag tag, const folly::dynamic &config) noexcept;
@@ -209,6 +214,7 @@ class NativeAnimatedNodesManager {
   std::unordered_map<Tag, std::unique_ptr<AnimatedNode>> animatedNodes_;
   std::unordered_map<Tag, Tag> connectedAnimatedNodes_;
   std::unordered_map<int, std::unique_ptr<AnimationDriver>> activeAnimations_;
+  AnimationDriverBatch animationDriverBatch_;
   std::unordered_map<
       EventAnimationDriverKey,
       std::vector<std::unique_ptr<EventAnimationDriver>>,
@@ -243,8 +249,20 @@ class NativeAnimatedNodesManager {
 
   std::shared_ptr<EventEmitterListener> eventEmitterListener_{nullptr};
 
-  std::unordered_map<Tag, folly::dynamic> updateViewProps_{};
-  std::unordered_map<Tag, folly::dynamic> updateViewPropsDirect_{};
+  using ViewPropsMap = std::unordered_map<Tag, folly::dynamic>;
+
+  ViewPropsMap updateViewProps_{};
+  ViewPropsMap updateViewPropsDirect_{};
+
+  /*
+   * Entries of `updateViewProps_` and `updateViewPropsDirect_` taken out when
+   * props are committed. They are put back when views are updated on the next
+   * frame, preferably for the same view, so steady animations reuse the map
+   * nodes and the props objects instead of allocating them on every frame.
+   * They hold at most as many entries as views were updated in one frame.
+   */
+  std::vector<ViewPropsMap::node_type> releasedViewProps_{};
+  std::vector<ViewPropsMap::node_type> releasedViewPropsDirect_{};
 
   /*
    * Sometimes a view is not longer connected to a PropsAnimatedNode, but
@@ -256,10 +274,32 @@ class NativeAnimatedNodesManager {
   mutable std::mutex unsyncedDirectViewPropsMutex_;
   std::unordered_map<Tag, folly::dynamic> unsyncedDirectViewProps_{};
 
-  int animatedGraphBFSColor_ = 0;
-#ifdef REACT_NATIVE_DEBUG
-  bool warnedAboutGraphTraversal_ = false;
-#endif
+  /*
+   * All nodes of the graph in topological order, grouped by connected
+   * component, so that a frame evaluates the nodes reachable from the updated
+   * ones with a linear sweep over the components containing them. Children
+   * are stored as positions in `nodes`. Rebuilt on the next frame after nodes
+   * are connected, disconnected or dropped.
+   */
+  struct EvaluationOrder {
+    std::vector<AnimatedNode *> nodes;
+    // Children of `nodes[i]` are `children[childrenOffsets[i]]` up to
+    // `children[childrenOffsets[i + 1]]`.
+    std::vector<size_t> childrenOffsets;
+    std::vector<size_t> children;
+    std::vector<size_t> components;
+    // Nodes of component `c` are `nodes[componentOffsets[c]]` up to
+    // `nodes[componentOffsets[c + 1]]`.
+    std::vector<size_t> componentOffsets;
+  };
+
+  EvaluationOrder evaluationOrder_;
+  bool isEvaluationOrderValid_{false};
+
+  // Reused across frames by `updateNodes`.
+  std::vector<uint8_t> nodeEvaluationStates_;
+  std::vector<bool> isComponentUpdated_;
+  std::vector<size_t> updatedComponents_;
 
   friend class ColorAnimatedNode;
   friend class AnimationDriver;
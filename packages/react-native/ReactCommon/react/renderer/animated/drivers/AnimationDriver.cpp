@@ -62,8 +62,36 @@ void AnimationDriver::stopAnimation(bool /*ignoreCompletedHandlers*/) {
 }
 
 void AnimationDriver::runAnimationStep(double renderingTime) {
+  if (auto step = beginAnimationStep(renderingTime)) {
+    const auto [timeDeltaMs, restarting] = step.value();
+    endAnimationStep(update(timeDeltaMs, restarting));
+  }
+}
+
+void AnimationDriver::runAnimationStep(
+    double renderingTime,
+    AnimationDriverBatch& batch) {
+  if (auto step = beginAnimationStep(renderingTime)) {
+    const auto [timeDeltaMs, restarting] = step.value();
+    batchIndex_ = addToBatch(timeDeltaMs, restarting, batch);
+    if (!batchIndex_) {
+      endAnimationStep(update(timeDeltaMs, restarting));
+    }
+  }
+}
+
+void AnimationDriver::finishAnimationStep(const AnimationDriverBatch& batch) {
+  if (batchIndex_) {
+    const auto index = batchIndex_.value();
+    batchIndex_.reset();
+    endAnimationStep(updateFromBatch(batch, index));
+  }
+}
+
+std::optional<std::pair<double, bool>> AnimationDriver::beginAnimationStep(
+    double renderingTime) {
   if (!isStarted_ || isComplete_) {
-    return;
+    return std::nullopt;
   }
 
   const auto frameTimeMs = renderingTime;
@@ -73,9 +101,10 @@ void AnimationDriver::runAnimationStep(double renderingTime) {
     restarting = true;
   }
 
-  const auto timeDeltaMs = frameTimeMs - startFrameTimeMs_;
-  const auto isComplete = update(timeDeltaMs, restarting);
+  return std::make_pair(frameTimeMs - startFrameTimeMs_, restarting);
+}
 
+void AnimationDriver::endAnimationStep(bool isComplete) {
   if (isComplete) {
     if (iterations_ == -1 || ++currentIteration_ < iterations_) {
       startFrameTimeMs_ = -1;
@@ -13,6 +13,7 @@
 
 #include <react/debug/flags.h>
 #include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/drivers/AnimationDriverBatch.h>
 
 namespace facebook::react {
 
@@ -51,6 +52,15 @@ class AnimationDriver {
 
   void runAnimationStep(double renderingTime);
 
+  /*
+   * Same as `runAnimationStep(renderingTime)`, except that drivers supporting
+   * it add the sample of their curve to `batch` instead of evaluating it. The
+   * step is completed by `finishAnimationStep` after `batch` was evaluated.
+   */
+  void runAnimationStep(double renderingTime, AnimationDriverBatch &batch);
+
+  void finishAnimationStep(const AnimationDriverBatch &batch);
+
   virtual void updateConfig(folly::dynamic config);
 
 #ifdef REACT_NATIVE_DEBUG
@@ -68,6 +78,23 @@ class AnimationDriver {
     return true;
   }
 
+  /*
+   * Batched counterpart of `update`, split in two: `addToBatch` returns the
+   * index of the sample added to the batch, or nothing if the driver has to
+   * `update` instead, and `updateFromBatch` applies the evaluated sample and
+   * returns whether the animation is complete.
+   */
+  virtual std::optional<size_t>
+  addToBatch(double /*timeDeltaMs*/, bool /*restarting*/, AnimationDriverBatch & /*batch*/)
+  {
+    return std::nullopt;
+  }
+
+  virtual bool updateFromBatch(const AnimationDriverBatch & /*batch*/, size_t /*index*/)
+  {
+    return true;
+  }
+
   void markNodeUpdated(Tag tag)
   {
     manager_->updatedNodeTags_.insert(tag);
@@ -90,6 +117,12 @@ class AnimationDriver {
 
  private:
   void onConfigChanged();
+
+  std::optional<std::pair<double, bool>> beginAnimationStep(double renderingTime);
+
+  void endAnimationStep(bool isComplete);
+
+  std::optional<size_t> batchIndex_;
 };
 
 } // namespace facebook::react
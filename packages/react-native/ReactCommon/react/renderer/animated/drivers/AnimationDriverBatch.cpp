@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimationDriverBatch.h"
+
+#include <react/debug/react_native_assert.h>
+
+#include <bit>
+#include <cstdint>
+
+namespace facebook::react {
+
+namespace {
+
+// Branch-free replacements of std::exp, std::sin and std::cos, so that the
+// loop of `AnimationDriverBatch::evaluate` can be vectorized. They are
+// accurate to a few ulps over the arguments animation curves use.
+
+// Adding and subtracting this constant rounds a double to an integer, which
+// can then be read from its low bits.
+constexpr double RoundingShift = 6755399441055744.0; // 0x1.8p52
+
+// Selects with bit operations, since conditional floating point operations
+// keep loops from being vectorized.
+inline double batchSelect(bool condition, double a, double b) {
+  const auto mask = uint64_t{0} - static_cast<uint64_t>(condition);
+  return std::bit_cast<double>(
+      (std::bit_cast<uint64_t>(a) & mask) |
+      (std::bit_cast<uint64_t>(b) & ~mask));
+}
+
+inline double batchExp(double x) {
+  constexpr double Log2e = 1.44269504088896338700e+00;
+  constexpr double Ln2Hi = 6.93147180369123816490e-01;
+  constexpr double Ln2Lo = 1.90821492927058770002e-10;
+
+  // Results below 1e-304 are flushed to 0 by the curves anyway.
+  x = batchSelect(x < -700.0, -700.0, batchSelect(x > 700.0, 700.0, x));
+
+  // exp(x) = 2^n * exp(r), with |r| <= ln(2) / 2.
+  auto shifted = x * Log2e + RoundingShift;
+  const auto n = std::bit_cast<uint64_t>(shifted);
+  shifted -= RoundingShift;
+  const auto r = x - shifted * Ln2Hi - shifted * Ln2Lo;
+
+  // Taylor series up to r^13 / 13!.
+  auto p = 1.0 / 6227020800.0;
+  p = p * r + 1.0 / 479001600.0;
+  p = p * r + 1.0 / 39916800.0;
+  p = p * r + 1.0 / 3628800.0;
+  p = p * r + 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  return p * std::bit_cast<double>((n + 1023) << 52);
+}
+
+inline void batchSinCos(double x, double& sin, double& cos) {
+  constexpr double TwoOverPi = 6.36619772367581382433e-01;
+  constexpr double PiOver2Part1 = 1.57079632673412561417e+00;
+  constexpr double PiOver2Part2 = 6.07710050630396597660e-11;
+  constexpr double PiOver2Part3 = 2.02226624871116645580e-21;
+
+  // x = n * pi / 2 + r, with |r| <= pi / 4.
+  auto shifted = x * TwoOverPi + RoundingShift;
+  const auto n = std::bit_cast<uint64_t>(shifted);
+  shifted -= RoundingShift;
+  const auto r = x - shifted * PiOver2Part1 - shifted * PiOver2Part2 -
+      shifted * PiOver2Part3;
+  const auto z = r * r;
+
+  // Minimax polynomials of fdlibm's __kernel_sin and __kernel_cos.
+  const auto sinR = r +
+      z * r *
+          (-1.66666666666666324348e-01 +
+           z *
+               (8.33333333332248946124e-03 +
+                z *
+                    (-1.98412698298579493134e-04 +
+                     z *
+                         (2.75573137070700676789e-06 +
+                          z *
+                              (-2.50507602534068634195e-08 +
+                               z * 1.58969099521155010221e-10)))));
+  const auto cosR = 1.0 - 0.5 * z +
+      z * z *
+          (4.16666666666666019037e-02 +
+           z *
+               (-1.38888888888741095749e-03 +
+                z *
+                    (2.48015872894767294178e-05 +
+                     z *
+                         (-2.75573143513906633035e-07 +
+                          z *
+                              (2.08757232129817482790e-09 +
+                               z * -1.13596475577881948265e-11)))));
+
+  // Rotate by the quadrant of x, with bit operations rather than branches.
+  const auto sinRBits = std::bit_cast<uint64_t>(sinR);
+  const auto cosRBits = std::bit_cast<uint64_t>(cosR);
+  const auto swapMask = uint64_t{0} - (n & 1);
+  const auto sinBits = (sinRBits & ~swapMask) | (cosRBits & swapMask);
+  const auto cosBits = (cosRBits & ~swapMask) | (sinRBits & swapMask);
+  sin = std::bit_cast<double>(sinBits ^ ((n & 2) << 62));
+  cos = std::bit_cast<double>(cosBits ^ (((n + 1) & 2) << 62));
+}
+
+} // namespace
+
+std::pair<double, double> AnimationDriverBatch::springValueAndVelocity(
+    const SpringCoefficients& coefficients,
+    double fromValue,
+    double toValue,
+    double v0,
+    double time) noexcept {
+  const auto zeta = coefficients.zeta;
+  const auto omega0 = coefficients.omega0;
+  const auto omega1 = coefficients.omega1;
+  const auto x0 = toValue - fromValue;
+
+  if (zeta < 1) {
+    const auto envelope = std::exp(-zeta * omega0 * time);
+    const auto sin = std::sin(omega1 * time);
+    const auto cos = std::cos(omega1 * time);
+    const auto value = toValue -
+        envelope * ((v0 + zeta * omega0 * x0) / omega1 * sin + x0 * cos);
+    const auto velocity = zeta * omega0 * envelope *
+            (sin * (v0 + zeta * omega0 * x0) / omega1 + x0 * cos) -
+        envelope * (cos * (v0 + zeta * omega0 * x0) - omega1 * x0 * sin);
+    return {value, velocity};
+  } else {
+    const auto envelope = std::exp(-omega0 * time);
+    const auto value = toValue - envelope * (x0 + (v0 + omega0 * x0) * time);
+    const auto velocity =
+        envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+    return {value, velocity};
+  }
+}
+
+void AnimationDriverBatch::reset(size_t capacity) {
+  // Samples are stored by index rather than pushed, which is cheaper when
+  // there are many of them.
+  springs_.count = 0;
+  if (springs_.times.size() < capacity) {
+    springs_.zetas.resize(capacity);
+    springs_.omega0s.resize(capacity);
+    springs_.omega1s.resize(capacity);
+    springs_.fromValues.resize(capacity);
+    springs_.toValues.resize(capacity);
+    springs_.v0s.resize(capacity);
+    springs_.times.resize(capacity);
+    springs_.results.resize(capacity * 2);
+  }
+}
+
+size_t AnimationDriverBatch::addSpring(
+    const SpringCoefficients& coefficients,
+    double fromValue,
+    double toValue,
+    double v0,
+    double time) {
+  react_native_assert(springs_.count < springs_.times.size());
+  const auto index = springs_.count++;
+  springs_.zetas[index] = coefficients.zeta;
+  springs_.omega0s[index] = coefficients.omega0;
+  springs_.omega1s[index] = coefficients.omega1;
+  springs_.fromValues[index] = fromValue;
+  springs_.toValues[index] = toValue;
+  springs_.v0s[index] = v0;
+  springs_.times[index] = time;
+  return index;
+}
+
+void AnimationDriverBatch::evaluate() noexcept {
+  // Same as `springValueAndVelocity`, without branches. Values and velocities
+  // are stored interleaved, since compilers give up on vectorizing loops that
+  // write to too many arrays that might alias the inputs.
+  const auto springCount = springs_.count;
+  for (size_t i = 0; i < springCount; i++) {
+    const auto zeta = springs_.zetas[i];
+    const auto omega0 = springs_.omega0s[i];
+    const auto omega1 = springs_.omega1s[i];
+    const auto toValue = springs_.toValues[i];
+    const auto v0 = springs_.v0s[i];
+    const auto time = springs_.times[i];
+    const auto x0 = toValue - springs_.fromValues[i];
+    const auto isUnderdamped = zeta < 1;
+
+    const auto envelope =
+        batchExp(-batchSelect(isUnderdamped, zeta * omega0, omega0) * time);
+    double sin = 0;
+    double cos = 0;
+    batchSinCos(batchSelect(isUnderdamped, omega1 * time, 0.0), sin, cos);
+
+    const auto a = v0 + zeta * omega0 * x0;
+    const auto underdampedValue =
+        toValue - envelope * (a / omega1 * sin + x0 * cos);
+    const auto underdampedVelocity =
+        zeta * omega0 * envelope * (sin * a / omega1 + x0 * cos) -
+        envelope * (cos * a - omega1 * x0 * sin);
+    const auto overdampedValue =
+        toValue - envelope * (x0 + (v0 + omega0 * x0) * time);
+    const auto overdampedVelocity =
+        envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+
+    springs_.results[2 * i] =
+        batchSelect(isUnderdamped, underdampedValue, overdampedValue);
+    springs_.results[2 * i + 1] =
+        batchSelect(isUnderdamped, underdampedVelocity, overdampedVelocity);
+  }
+}
+
+} // namespace facebook::react
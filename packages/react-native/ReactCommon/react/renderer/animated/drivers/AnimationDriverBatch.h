@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Coefficients of a damped harmonic oscillator that only depend on the
+ * configuration of a spring animation.
+ */
+struct SpringCoefficients {
+  double zeta{0};
+  double omega0{0};
+  double omega1{0};
+
+  SpringCoefficients() = default;
+
+  SpringCoefficients(double stiffness, double damping, double mass)
+      : zeta(damping / (2 * std::sqrt(stiffness * mass))),
+        omega0(std::sqrt(stiffness / mass)),
+        omega1(omega0 * std::sqrt(1.0 - (zeta * zeta)))
+  {
+  }
+};
+
+/*
+ * Evaluates the curves sampled by the spring animations running on a frame in
+ * one pass over structure-of-arrays storage, instead of one animation driver
+ * at a time. The storage is kept across frames.
+ */
+class AnimationDriverBatch {
+ public:
+  /*
+   * Whether the loop of `evaluate` is vectorized on this target. Without it,
+   * the batch is slower than evaluating springs one at a time.
+   */
+  static constexpr bool isVectorized()
+  {
+#if defined(__AVX2__) || defined(__aarch64__)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /*
+   * Value and velocity at `time` (in seconds) of a spring going from
+   * `fromValue` to `toValue` with initial velocity `v0`.
+   */
+  static std::pair<double, double> springValueAndVelocity(
+      const SpringCoefficients &coefficients,
+      double fromValue,
+      double toValue,
+      double v0,
+      double time) noexcept;
+
+  /*
+   * Drops the samples of the previous frame, and makes room for up to
+   * `capacity` new ones.
+   */
+  void reset(size_t capacity);
+
+  /*
+   * Add a sample to evaluate, and return its index to get the result with
+   * once `evaluate` was called.
+   */
+  size_t addSpring(const SpringCoefficients &coefficients, double fromValue, double toValue, double v0, double time);
+
+  void evaluate() noexcept;
+
+  std::pair<double, double> getSpringValueAndVelocity(size_t index) const noexcept
+  {
+    return {springs_.results[2 * index], springs_.results[2 * index + 1]};
+  }
+
+ private:
+  struct Springs {
+    std::vector<double> zetas;
+    std::vector<double> omega0s;
+    std::vector<double> omega1s;
+    std::vector<double> fromValues;
+    std::vector<double> toValues;
+    std::vector<double> v0s;
+    std::vector<double> times;
+    // Value and velocity of each spring, one after the other.
+    std::vector<double> results;
+    size_t count{0};
+  };
+
+  Springs springs_;
+};
+
+} // namespace facebook::react
@@ -15,9 +15,17 @@
 
 namespace facebook::react {
 
-static constexpr std::string_view ExtrapolateTypeIdentity = "identity";
-static constexpr std::string_view ExtrapolateTypeClamp = "clamp";
-static constexpr std::string_view ExtrapolateTypeExtend = "extend";
+enum class ExtrapolateType { Extend, Identity, Clamp };
+
+inline ExtrapolateType extrapolateTypeFromString(std::string_view extrapolateType)
+{
+  if (extrapolateType == "identity") {
+    return ExtrapolateType::Identity;
+  } else if (extrapolateType == "clamp") {
+    return ExtrapolateType::Clamp;
+  }
+  return ExtrapolateType::Extend;
+}
 
 static constexpr double SingleFrameIntervalMs = 1000.0 / 60.0;
 
@@ -29,24 +37,24 @@ inline double interpolate(
     double inputMax,
     double outputMin,
     double outputMax,
-    std::string_view extrapolateLeft,
-    std::string_view extrapolateRight)
+    ExtrapolateType extrapolateLeft,
+    ExtrapolateType extrapolateRight)
 {
   auto result = inputValue;
 
   // Extrapolate
   if (result < inputMin) {
-    if (extrapolateLeft == ExtrapolateTypeIdentity) {
+    if (extrapolateLeft == ExtrapolateType::Identity) {
       return result;
-    } else if (extrapolateLeft == ExtrapolateTypeClamp) {
+    } else if (extrapolateLeft == ExtrapolateType::Clamp) {
       result = inputMin;
     }
   }
 
   if (result > inputMax) {
-    if (extrapolateRight == ExtrapolateTypeIdentity) {
+    if (extrapolateRight == ExtrapolateType::Identity) {
       return result;
-    } else if (extrapolateRight == ExtrapolateTypeClamp) {
+    } else if (extrapolateRight == ExtrapolateType::Clamp) {
       result = inputMax;
     }
   }
@@ -86,8 +86,8 @@ bool FrameAnimationDriver::update(double timeDeltaMs, bool /*restarting*/) {
           toInterval,
           fromValue,
           toValue,
-          ExtrapolateTypeExtend,
-          ExtrapolateTypeExtend);
+          ExtrapolateType::Extend,
+          ExtrapolateType::Extend);
 
       // Map frame to output value
       nextValue = interpolate(
@@ -96,8 +96,8 @@ bool FrameAnimationDriver::update(double timeDeltaMs, bool /*restarting*/) {
           1,
           startValue_.value(),
           toValue_,
-          ExtrapolateTypeExtend,
-          ExtrapolateTypeExtend);
+          ExtrapolateType::Extend,
+          ExtrapolateType::Extend);
     }
 
     if (node->setRawValue(nextValue)) {
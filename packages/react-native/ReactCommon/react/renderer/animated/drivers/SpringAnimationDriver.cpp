@@ -37,96 +37,102 @@ SpringAnimationDriver::SpringAnimationDriver(
       restSpeedThreshold_(config_["restSpeedThreshold"].asDouble()),
       displacementFromRestThreshold_(
           config_["restDisplacementThreshold"].asDouble()),
-      overshootClampingEnabled_(config_["overshootClamping"].asBool()) {}
+      overshootClampingEnabled_(config_["overshootClamping"].asBool()),
+      coefficients_(springStiffness_, springDamping_, springMass_) {}
 
 std::tuple<float, double> SpringAnimationDriver::getValueAndVelocityForTime(
     double time) const {
-  const auto startValue = fromValue_.value();
-  const auto toValue = endValue_;
-  const auto c = springDamping_;
-  const auto m = springMass_;
-  const auto k = springStiffness_;
-  const auto v0 = -initialVelocity_;
-
-  const auto zeta = c / (2 * std::sqrt(k * m));
-  const auto omega0 = std::sqrt(k / m);
-  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
-  const auto x0 = toValue - startValue;
-
-  if (zeta < 1) {
-    const auto envelope = std::exp(-zeta * omega0 * time);
-    const auto value = static_cast<float>(
-        toValue -
-        envelope *
-            ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) +
-             x0 * std::cos(omega1 * time)));
-    const auto velocity = zeta * omega0 * envelope *
-            (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 +
-             x0 * std::cos(omega1 * time)) -
-        envelope *
-            (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) -
-             omega1 * x0 * std::sin(omega1 * time));
-    return std::make_tuple(value, velocity);
-  } else {
-    const auto envelope = std::exp(-omega0 * time);
-    const auto value = static_cast<float>(
-        endValue_ - envelope * (x0 + (v0 + omega0 * x0) * time));
-    const auto velocity =
-        envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
-    return std::make_tuple(value, velocity);
-  }
+  const auto [value, velocity] = AnimationDriverBatch::springValueAndVelocity(
+      coefficients_, fromValue_.value(), endValue_, -initialVelocity_, time);
+  return std::make_tuple(static_cast<float>(value), velocity);
 }
 
 bool SpringAnimationDriver::update(double timeDeltaMs, bool restarting) {
   if (const auto node =
           manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_)) {
-    if (restarting) {
-      if (!fromValue_.has_value()) {
-        fromValue_ = node->getRawValue();
-      } else {
-        if (node->setRawValue(fromValue_.value())) {
-          markNodeUpdated(node->tag());
-        }
-      }
+    const auto time = advanceTime(*node, timeDeltaMs, restarting);
+    const auto [value, velocity] = getValueAndVelocityForTime(time);
+    return applyValueAndVelocity(*node, value, velocity);
+  }
 
-      // Spring animations run a frame behind JS driven animations if we do
-      // not start the first frame at 16ms.
-      lastTime_ = timeDeltaMs - SingleFrameIntervalMs;
-      timeAccumulator_ = 0.0;
-    }
+  return true;
+}
 
-    // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
-    // We should be able to catch up in a subsequent advance if necessary.
-    auto adjustedDeltaTime = timeDeltaMs - lastTime_;
-    if (adjustedDeltaTime > MaxDeltaTimeMs) {
-      adjustedDeltaTime = MaxDeltaTimeMs;
-    }
-    timeAccumulator_ += adjustedDeltaTime;
-    lastTime_ = timeDeltaMs;
-
-    auto [value, velocity] =
-        getValueAndVelocityForTime(timeAccumulator_ / 1000.0);
-
-    auto isComplete = false;
-    if (isAtRest(velocity, value, endValue_) ||
-        (overshootClampingEnabled_ && isOvershooting(value))) {
-      if (springStiffness_ > 0) {
-        value = static_cast<float>(endValue_);
-      } else {
-        endValue_ = value;
-      }
+std::optional<size_t> SpringAnimationDriver::addToBatch(
+    double timeDeltaMs,
+    bool restarting,
+    AnimationDriverBatch& batch) {
+  if (const auto node =
+          manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_)) {
+    const auto time = advanceTime(*node, timeDeltaMs, restarting);
+    batchedNode_ = node;
+    return batch.addSpring(
+        coefficients_, fromValue_.value(), endValue_, -initialVelocity_, time);
+  }
+
+  return std::nullopt;
+}
+
+bool SpringAnimationDriver::updateFromBatch(
+    const AnimationDriverBatch& batch,
+    size_t index) {
+  const auto [value, velocity] = batch.getSpringValueAndVelocity(index);
+  return applyValueAndVelocity(
+      *batchedNode_, static_cast<float>(value), velocity);
+}
 
-      isComplete = true;
+double SpringAnimationDriver::advanceTime(
+    ValueAnimatedNode& node,
+    double timeDeltaMs,
+    bool restarting) {
+  if (restarting) {
+    if (!fromValue_.has_value()) {
+      fromValue_ = node.getRawValue();
+    } else {
+      if (node.setRawValue(fromValue_.value())) {
+        markNodeUpdated(node.tag());
+      }
     }
 
-    if (node->setRawValue(value)) {
-      markNodeUpdated(node->tag());
+    // Spring animations run a frame behind JS driven animations if we do
+    // not start the first frame at 16ms.
+    lastTime_ = timeDeltaMs - SingleFrameIntervalMs;
+    timeAccumulator_ = 0.0;
+  }
+
+  // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
+  // We should be able to catch up in a subsequent advance if necessary.
+  auto adjustedDeltaTime = timeDeltaMs - lastTime_;
+  if (adjustedDeltaTime > MaxDeltaTimeMs) {
+    adjustedDeltaTime = MaxDeltaTimeMs;
+  }
+  timeAccumulator_ += adjustedDeltaTime;
+  lastTime_ = timeDeltaMs;
+
+  return timeAccumulator_ / 1000.0;
+}
+
+bool SpringAnimationDriver::applyValueAndVelocity(
+    ValueAnimatedNode& node,
+    float value,
+    double velocity) {
+  auto isComplete = false;
+  if (isAtRest(velocity, value, endValue_) ||
+      (overshootClampingEnabled_ && isOvershooting(value))) {
+    if (springStiffness_ > 0) {
+      value = static_cast<float>(endValue_);
+    } else {
+      endValue_ = value;
     }
 
-    return isComplete;
+    isComplete = true;
   }
 
-  return true;
+  if (node.setRawValue(value)) {
+    markNodeUpdated(node.tag());
+  }
+
+  return isComplete;
 }
 
 bool SpringAnimationDriver::isAtRest(
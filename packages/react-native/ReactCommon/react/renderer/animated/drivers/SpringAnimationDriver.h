@@ -15,6 +15,8 @@
 
 namespace facebook::react {
 
+class ValueAnimatedNode;
+
 class SpringAnimationDriver : public AnimationDriver {
  public:
   SpringAnimationDriver(
@@ -27,8 +29,14 @@ class SpringAnimationDriver : public AnimationDriver {
  protected:
   bool update(double timeDeltaMs, bool restarting) override;
 
+  std::optional<size_t> addToBatch(double timeDeltaMs, bool restarting, AnimationDriverBatch &batch) override;
+
+  bool updateFromBatch(const AnimationDriverBatch &batch, size_t index) override;
+
  private:
   std::tuple<float, double> getValueAndVelocityForTime(double time) const;
+  double advanceTime(ValueAnimatedNode &node, double timeDeltaMs, bool restarting);
+  bool applyValueAndVelocity(ValueAnimatedNode &node, float value, double velocity);
   bool isAtRest(double currentVelocity, double currentValue, double endValue) const;
   bool isOvershooting(double currentValue) const;
 
@@ -41,6 +49,10 @@ class SpringAnimationDriver : public AnimationDriver {
   double restSpeedThreshold_{0};
   double displacementFromRestThreshold_{0};
   bool overshootClampingEnabled_{false};
+  SpringCoefficients coefficients_;
+  // Node of the sample in the batch, which can't be dropped before the
+  // batch was evaluated.
+  ValueAnimatedNode *batchedNode_{nullptr};
 
   double lastTime_{0};
   double timeAccumulator_{0};
@@ -12,14 +12,14 @@
 
 namespace facebook::react {
 
-inline static std::unordered_set<std::string> getDirectManipulationAllowlist()
+inline static const std::unordered_set<std::string> &getDirectManipulationAllowlist()
 {
   /**
    * Direct manipulation eligible styles allowed by the NativeAnimated JS
    * implementation. Keep in sync with
    * packages/react-native/Libraries/Animated/NativeAnimatedAllowlist.js
    */
-  static std::unordered_set<std::string> DIRECT_MANIPULATION_STYLES{
+  static const std::unordered_set<std::string> DIRECT_MANIPULATION_STYLES{
       /* SUPPORTED_COLOR_STYLES */
       "backgroundColor",
       "borderBottomColor",
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <folly/dynamic.h>
+#include <optional>
 #include <react/debug/flags.h>
 #include <react/renderer/core/ReactPrimitives.h>
 
@@ -93,10 +94,10 @@ class AnimatedNode {
 
   static std::optional<AnimatedNodeType> getNodeTypeByName(const std::string &nodeTypeName);
 
-  int activeIncomingNodes = 0;
-  int bfsColor = 0;
-
-  static constexpr int INITIAL_BFS_COLOR = 0;
+  // Position of the node in the evaluation order of the graph cached by
+  // NativeAnimatedNodesManager, unless the order was built before the node was
+  // created or the node is part of a cycle.
+  std::optional<size_t> evaluationOrderIndex;
 
  protected:
   AnimatedNode *getChildNode(Tag tag);
@@ -16,6 +16,8 @@
 #include <react/renderer/animated/internal/primitives.h>
 #include <react/renderer/graphics/HostPlatformColor.h>
 
+#include <algorithm>
+
 namespace facebook::react {
 
 InterpolationAnimatedNode::InterpolationAnimatedNode(
@@ -34,7 +36,13 @@ InterpolationAnimatedNode::InterpolationAnimatedNode(
   if (isColorOutput) {
     isColorValue_ = true;
     for (const auto& rangeValue : nodeConfig["outputRange"]) {
-      colorOutputRanges_.push_back(static_cast<int>(rangeValue.asInt()));
+      const Color color = static_cast<int>(rangeValue.asInt());
+      colorOutputRanges_.push_back(color);
+      unpackedColorOutputRanges_.push_back(UnpackedColor{
+          .red = redFromHostPlatformColor(color),
+          .green = greenFromHostPlatformColor(color),
+          .blue = blueFromHostPlatformColor(color),
+          .alpha = alphaFromHostPlatformColor(color)});
     }
   } else {
     for (const auto& rangeValue : nodeConfig["outputRange"]) {
@@ -42,8 +50,10 @@ InterpolationAnimatedNode::InterpolationAnimatedNode(
     }
   }
 
-  extrapolateLeft_ = nodeConfig["extrapolateLeft"].asString();
-  extrapolateRight_ = nodeConfig["extrapolateRight"].asString();
+  extrapolateLeft_ =
+      extrapolateTypeFromString(nodeConfig["extrapolateLeft"].asString());
+  extrapolateRight_ =
+      extrapolateTypeFromString(nodeConfig["extrapolateRight"].asString());
 }
 
 void InterpolationAnimatedNode::update() {
@@ -71,15 +81,27 @@ void InterpolationAnimatedNode::onAttachToNode(Tag animatedNodeTag) {
   parentTag_ = animatedNodeTag;
 }
 
-double InterpolationAnimatedNode::interpolateValue(double value) {
-  // Compute range index
-  int index = 1;
-  for (; index < inputRanges_.size() - 1; ++index) {
-    if (inputRanges_[index] >= value) {
-      break;
-    }
+size_t InterpolationAnimatedNode::findSegment(double value) {
+  // The segment starts at the input before the first one from the second to
+  // the second to last that is >= value, or at the second to last input.
+  const auto inputCount = inputRanges_.size();
+  const auto segment = lastSegment_;
+  if ((segment == 0 || inputRanges_[segment] < value) &&
+      (segment + 2 == inputCount || inputRanges_[segment + 1] >= value)) {
+    return segment;
   }
-  index--;
+
+  const auto input = std::partition_point(
+      inputRanges_.begin() + 1,
+      inputRanges_.end() - 1,
+      [value](double inputValue) { return !(inputValue >= value); });
+  lastSegment_ =
+      static_cast<size_t>(std::distance(inputRanges_.begin(), input)) - 1;
+  return lastSegment_;
+}
+
+double InterpolationAnimatedNode::interpolateValue(double value) {
+  const auto index = findSegment(value);
 
   return interpolate(
       value,
@@ -92,14 +114,7 @@ double InterpolationAnimatedNode::interpolateValue(double value) {
 }
 
 double InterpolationAnimatedNode::interpolateColor(double value) {
-  // Compute range index
-  int index = 1;
-  for (; index < inputRanges_.size() - 1; ++index) {
-    if (inputRanges_[index] >= value) {
-      break;
-    }
-  }
-  index--;
+  const auto index = findSegment(value);
 
   const auto outputMin = colorOutputRanges_[index];
   const auto outputMax = colorOutputRanges_[index + 1];
@@ -119,20 +134,20 @@ double InterpolationAnimatedNode::interpolateColor(double value) {
 
   auto ratio = (value - inputMin) / (inputMax - inputMin);
 
-  auto outputMinA = alphaFromHostPlatformColor(outputMin);
-  auto outputMinR = redFromHostPlatformColor(outputMin);
-  auto outputMinG = greenFromHostPlatformColor(outputMin);
-  auto outputMinB = blueFromHostPlatformColor(outputMin);
-
-  auto outputMaxA = alphaFromHostPlatformColor(outputMax);
-  auto outputMaxR = redFromHostPlatformColor(outputMax);
-  auto outputMaxG = greenFromHostPlatformColor(outputMax);
-  auto outputMaxB = blueFromHostPlatformColor(outputMax);
-
-  auto outputValueA = ratio * (outputMaxA - outputMinA) + outputMinA;
-  auto outputValueR = ratio * (outputMaxR - outputMinR) + outputMinR;
-  auto outputValueG = ratio * (outputMaxG - outputMinG) + outputMinG;
-  auto outputValueB = ratio * (outputMaxB - outputMinB) + outputMinB;
+  const auto& outputMinColor = unpackedColorOutputRanges_[index];
+  const auto& outputMaxColor = unpackedColorOutputRanges_[index + 1];
+
+  auto outputValueA =
+      ratio * (outputMaxColor.alpha - outputMinColor.alpha) +
+      outputMinColor.alpha;
+  auto outputValueR =
+      ratio * (outputMaxColor.red - outputMinColor.red) + outputMinColor.red;
+  auto outputValueG =
+      ratio * (outputMaxColor.green - outputMinColor.green) +
+      outputMinColor.green;
+  auto outputValueB =
+      ratio * (outputMaxColor.blue - outputMinColor.blue) +
+      outputMinColor.blue;
 
   return static_cast<int32_t>(hostPlatformColorFromRGBA(
       static_cast<uint8_t>(outputValueR),
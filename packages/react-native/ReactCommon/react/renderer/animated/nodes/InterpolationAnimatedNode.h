@@ -13,9 +13,12 @@
 
 #include "ValueAnimatedNode.h"
 
+#include <react/renderer/animated/drivers/AnimationDriverUtils.h>
 #include <react/renderer/animated/internal/primitives.h>
 #include <react/renderer/graphics/Color.h>
 
+#include <vector>
+
 namespace facebook::react {
 
 class InterpolationAnimatedNode final : public ValueAnimatedNode {
@@ -27,14 +30,28 @@ class InterpolationAnimatedNode final : public ValueAnimatedNode {
   void onAttachToNode(Tag animatedNodeTag) override;
 
  private:
+  struct UnpackedColor {
+    float red;
+    float green;
+    float blue;
+    float alpha;
+  };
+
+  size_t findSegment(double value);
   double interpolateValue(double value);
   double interpolateColor(double value);
 
   std::vector<double> inputRanges_;
   std::vector<double> defaultOutputRanges_;
   std::vector<Color> colorOutputRanges_;
-  std::string extrapolateLeft_;
-  std::string extrapolateRight_;
+  // Components of `colorOutputRanges_`, unpacked once instead of per frame.
+  std::vector<UnpackedColor> unpackedColorOutputRanges_;
+  ExtrapolateType extrapolateLeft_{ExtrapolateType::Extend};
+  ExtrapolateType extrapolateRight_{ExtrapolateType::Extend};
+
+  // Segment of the input range found by the last lookup. Animated values
+  // mostly move between neighbouring inputs from one frame to the next.
+  size_t lastSegment_{0};
 
   Tag parentTag_{animated::undefinedAnimatedNodeIdentifier};
 };
@@ -89,7 +89,7 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
   std::lock_guard<std::mutex> lock(propsMutex_);
   const auto& configProps = getConfig()["props"];
   for (const auto& entry : configProps.items()) {
-    auto propName = entry.first.asString();
+    const auto& propName = entry.first;
     auto nodeTag = static_cast<Tag>(entry.second.asInt());
     if (auto node = manager_->getAnimatedNode<AnimatedNode>(nodeTag)) {
       switch (node->type()) {
@@ -106,19 +106,16 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
           if (const auto& valueNode =
                   manager_->getAnimatedNode<ValueAnimatedNode>(nodeTag)) {
             if (valueNode->getIsColorValue()) {
-              props_.insert(
-                  propName.c_str(),
-                  static_cast<int32_t>(valueNode->getValue()));
+              props_[propName] = static_cast<int32_t>(valueNode->getValue());
             } else {
-              props_.insert(propName.c_str(), valueNode->getValue());
+              props_[propName] = valueNode->getValue();
             }
           }
         } break;
         case AnimatedNodeType::Color: {
           if (const auto& colorNode =
                   manager_->getAnimatedNode<ColorAnimatedNode>(nodeTag)) {
-            props_.insert(
-                propName.c_str(), static_cast<int32_t>(colorNode->getColor()));
+            props_[propName] = static_cast<int32_t>(colorNode->getColor());
           }
         } break;
         case AnimatedNodeType::Style: {
@@ -130,7 +127,7 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
         case AnimatedNodeType::Object: {
           if (const auto objectNode =
                   manager_->getAnimatedNode<ObjectAnimatedNode>(nodeTag)) {
-            objectNode->collectViewUpdates(propName, props_);
+            objectNode->collectViewUpdates(propName.getString(), props_);
           }
         } break;
         case AnimatedNodeType::Props:
@@ -25,7 +25,7 @@ namespace {
 bool isLayoutPropsUpdated(const folly::dynamic& props) {
   for (const auto& styleNodeProp : props.items()) {
     if (getDirectManipulationAllowlist().count(
-            styleNodeProp.first.asString()) == 0u) {
+            styleNodeProp.first.getString()) == 0u) {
       return true;
     }
   }
@@ -44,7 +44,7 @@ StyleAnimatedNode::StyleAnimatedNode(
 void StyleAnimatedNode::collectViewUpdates(folly::dynamic& props) {
   const auto& style = getConfig()["style"];
   for (const auto& styleProp : style.items()) {
-    auto propName = styleProp.first.asString();
+    const auto& propName = styleProp.first;
     const auto nodeTag = static_cast<Tag>(styleProp.second.asInt());
     if (auto node = manager_->getAnimatedNode<AnimatedNode>(nodeTag)) {
       switch (node->type()) {
@@ -67,26 +67,22 @@ void StyleAnimatedNode::collectViewUpdates(folly::dynamic& props) {
           if (const auto valueNode =
                   manager_->getAnimatedNode<ValueAnimatedNode>(nodeTag)) {
             if (valueNode->getIsColorValue()) {
-              props.insert(
-                  propName.c_str(),
-                  static_cast<int32_t>(valueNode->getValue()));
+              props[propName] = static_cast<int32_t>(valueNode->getValue());
             } else {
-              props.insert(propName.c_str(), valueNode->getValue());
+              props[propName] = valueNode->getValue();
             }
           }
         } break;
         case AnimatedNodeType::Color: {
           if (const auto colorAnimNode =
                   manager_->getAnimatedNode<ColorAnimatedNode>(nodeTag)) {
-            props.insert(
-                propName.c_str(),
-                static_cast<int32_t>(colorAnimNode->getColor()));
+            props[propName] = static_cast<int32_t>(colorAnimNode->getColor());
           }
         } break;
         case AnimatedNodeType::Object: {
           if (const auto objectNode =
                   manager_->getAnimatedNode<ObjectAnimatedNode>(nodeTag)) {
-            objectNode->collectViewUpdates(propName, props);
+            objectNode->collectViewUpdates(propName.getString(), props);
           }
         } break;
         case AnimatedNodeType::Tracking:
@@ -33,12 +33,20 @@ TransformAnimatedNode::TransformAnimatedNode(
     : AnimatedNode(tag, config, manager, AnimatedNodeType::Transform) {}
 
 void TransformAnimatedNode::collectViewUpdates(folly::dynamic& props) {
-  folly::dynamic transforms = folly::dynamic::array();
-  auto transformsArray = getConfig()[sTransformsName];
+  const auto& transformsArray = getConfig()[sTransformsName];
   react_native_assert(transformsArray.type() == folly::dynamic::ARRAY);
+
+  // The transforms committed on the previous frame are updated in place as
+  // long as they have the same shape, so steady frames don't allocate.
+  auto& transforms = props[sTransformPropName];
+  if (!transforms.isArray()) {
+    transforms = folly::dynamic::array();
+  }
+
+  size_t index = 0;
   for (const auto& transform : transformsArray) {
     std::optional<double> value;
-    if (transform[sTypeName].asString() == sAnimatedName) {
+    if (transform[sTypeName].getString() == sAnimatedName) {
       const auto inputTag = static_cast<Tag>(transform[sNodeTagName].asInt());
       if (const auto node =
               manager_->getAnimatedNode<ValueAnimatedNode>(inputTag)) {
@@ -47,12 +55,22 @@ void TransformAnimatedNode::collectViewUpdates(folly::dynamic& props) {
     } else {
       value = transform[sValueName].asDouble();
     }
-    if (value) {
-      const auto property = transform[sPropertyName].asString();
+    if (!value) {
+      continue;
+    }
+
+    const auto& property = transform[sPropertyName].getString();
+    if (index < transforms.size() && transforms[index].isObject() &&
+        transforms[index].size() == 1 &&
+        transforms[index].count(property) != 0u) {
+      transforms[index][property] = value.value();
+    } else {
+      transforms.resize(index);
       transforms.push_back(folly::dynamic::object(property, value.value()));
     }
+    index++;
   }
-  props[sTransformPropName] = std::move(transforms);
+  transforms.resize(index);
 }
 
 } // namespace facebook::react
@@ -156,6 +156,164 @@ TEST_F(AnimatedNodeTests, updatePropsNode) {
   }
 }
 
+TEST_F(AnimatedNodeTests, reusesViewPropsAcrossFrames) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  auto opacityNodeTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      opacityNodeTag,
+      folly::dynamic::object("type", "value")("value", 0.8)("offset", 0));
+
+  auto styleNodeTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      styleNodeTag,
+      folly::dynamic::object("type", "style")(
+          "style", folly::dynamic::object("opacity", opacityNodeTag)));
+  nodesManager_->connectAnimatedNodes(opacityNodeTag, styleNodeTag);
+
+  auto propsNodeTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      propsNodeTag,
+      folly::dynamic::object("type", "props")(
+          "props", folly::dynamic::object("style", styleNodeTag)));
+  nodesManager_->connectAnimatedNodes(styleNodeTag, propsNodeTag);
+
+  auto viewTag = ++rootTag;
+  nodesManager_->connectAnimatedNodeToView(propsNodeTag, viewTag);
+
+  nodesManager_->setAnimatedNodeValue(opacityNodeTag, 0.5);
+  runAnimationFrame(0);
+  ASSERT_NE(lastCommittedPropsObject, nullptr);
+  auto firstFrameProps = lastCommittedPropsObject;
+  EXPECT_EQ(lastCommittedProps["opacity"], 0.5);
+  // The committed props are kept for the next frame.
+  EXPECT_EQ(releasedDirectViewProps(viewTag), firstFrameProps);
+
+  // The props of the view committed on the previous frame are updated in
+  // place instead of being allocated again.
+  nodesManager_->setAnimatedNodeValue(opacityNodeTag, 0.2);
+  runAnimationFrame(0);
+  EXPECT_EQ(lastCommittedPropsObject, firstFrameProps);
+  EXPECT_EQ(lastCommittedProps["opacity"], 0.2);
+  EXPECT_EQ(lastUpdatedNodeTag, viewTag);
+  EXPECT_EQ(releasedDirectViewProps(viewTag), firstFrameProps);
+}
+
+TEST_F(AnimatedNodeTests, updateNodesAfterGraphChanges) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  auto firstValueTag = ++rootTag;
+  auto secondValueTag = ++rootTag;
+  auto additionTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      firstValueTag,
+      folly::dynamic::object("type", "value")("value", 1)("offset", 0));
+  nodesManager_->createAnimatedNode(
+      secondValueTag,
+      folly::dynamic::object("type", "value")("value", 2)("offset", 0));
+  nodesManager_->createAnimatedNode(
+      additionTag,
+      folly::dynamic::object("type", "addition")(
+          "input", folly::dynamic::array(firstValueTag, secondValueTag)));
+  nodesManager_->connectAnimatedNodes(firstValueTag, additionTag);
+  nodesManager_->connectAnimatedNodes(secondValueTag, additionTag);
+
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(additionTag), 3);
+
+  // Nodes created and connected after the graph was evaluated
+  auto thirdValueTag = ++rootTag;
+  auto multiplicationTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      thirdValueTag,
+      folly::dynamic::object("type", "value")("value", 5)("offset", 0));
+  nodesManager_->createAnimatedNode(
+      multiplicationTag,
+      folly::dynamic::object("type", "multiplication")(
+          "input", folly::dynamic::array(additionTag, thirdValueTag)));
+  nodesManager_->connectAnimatedNodes(additionTag, multiplicationTag);
+  nodesManager_->connectAnimatedNodes(thirdValueTag, multiplicationTag);
+
+  nodesManager_->setAnimatedNodeValue(firstValueTag, 10);
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(additionTag), 12);
+  EXPECT_EQ(nodesManager_->getValue(multiplicationTag), 60);
+
+  // Disconnected nodes are no longer updated
+  nodesManager_->disconnectAnimatedNodes(additionTag, multiplicationTag);
+
+  nodesManager_->setAnimatedNodeValue(firstValueTag, 20);
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(additionTag), 22);
+  EXPECT_EQ(nodesManager_->getValue(multiplicationTag), 60);
+
+  // Dropped nodes are no longer updated
+  nodesManager_->disconnectAnimatedNodes(secondValueTag, additionTag);
+  nodesManager_->dropAnimatedNode(secondValueTag);
+
+  nodesManager_->setAnimatedNodeValue(thirdValueTag, 2);
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(multiplicationTag), 44);
+}
+
+TEST_F(AnimatedNodeTests, TransformAnimatedNode) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  auto translateXNodeTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      translateXNodeTag,
+      folly::dynamic::object("type", "value")("value", 10)("offset", 0));
+
+  auto transformNodeTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      transformNodeTag,
+      folly::dynamic::object("type", "transform")(
+          "transforms",
+          folly::dynamic::array(
+              folly::dynamic::object("type", "animated")(
+                  "property", "translateX")("nodeTag", translateXNodeTag),
+              folly::dynamic::object("type", "static")("property", "scale")(
+                  "value", 2))));
+  nodesManager_->connectAnimatedNodes(translateXNodeTag, transformNodeTag);
+
+  auto styleNodeTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      styleNodeTag,
+      folly::dynamic::object("type", "style")(
+          "style", folly::dynamic::object("transform", transformNodeTag)));
+  nodesManager_->connectAnimatedNodes(transformNodeTag, styleNodeTag);
+
+  auto propsNodeTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      propsNodeTag,
+      folly::dynamic::object("type", "props")(
+          "props", folly::dynamic::object("style", styleNodeTag)));
+  nodesManager_->connectAnimatedNodes(styleNodeTag, propsNodeTag);
+
+  auto viewTag = ++rootTag;
+  nodesManager_->connectAnimatedNodeToView(propsNodeTag, viewTag);
+
+  runAnimationFrame(0);
+
+  // The transforms are updated in place on the following frames
+  for (auto translateX : {20.0, 30.0}) {
+    nodesManager_->setAnimatedNodeValue(translateXNodeTag, translateX);
+    runAnimationFrame(0);
+
+    const auto& transforms = lastCommittedProps["transform"];
+    ASSERT_EQ(transforms.size(), 2);
+    EXPECT_EQ(transforms[0]["translateX"], translateX);
+    EXPECT_EQ(transforms[1]["scale"], 2);
+    EXPECT_EQ(lastUpdatedNodeTag, viewTag);
+  }
+}
+
 TEST_F(AnimatedNodeTests, ModulusAnimatedNode) {
   initNodesManager();
 
@@ -215,6 +373,77 @@ TEST_F(AnimatedNodeTests, DiffClampAnimatedNode) {
   EXPECT_EQ(nodesManager_->getValue(diffClampTag), 1);
 }
 
+TEST_F(AnimatedNodeTests, InterpolationAnimatedNode) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  auto valueTag = ++rootTag;
+  auto interpolationTag = ++rootTag;
+
+  nodesManager_->createAnimatedNode(
+      valueTag,
+      folly::dynamic::object("type", "value")("value", 5)("offset", 0));
+  nodesManager_->createAnimatedNode(
+      interpolationTag,
+      folly::dynamic::object("type", "interpolation")(
+          "inputRange", folly::dynamic::array(0, 10, 20, 30))(
+          "outputRange", folly::dynamic::array(0, 100, 100, 0))(
+          "outputType", nullptr)("extrapolateLeft", "clamp")(
+          "extrapolateRight", "extend"));
+  nodesManager_->connectAnimatedNodes(valueTag, interpolationTag);
+
+  // Values are looked up in segments both after and before the previous one
+  for (const auto& [value, expectedValue] :
+       std::vector<std::pair<double, double>>{
+           {5, 50},
+           {25, 50},
+           {15, 100},
+           {10, 100},
+           {5, 50},
+           {-5, 0},
+           {35, -50}}) {
+    nodesManager_->setAnimatedNodeValue(valueTag, value);
+    runAnimationFrame(0);
+    EXPECT_EQ(nodesManager_->getValue(interpolationTag), expectedValue);
+  }
+}
+
+TEST_F(AnimatedNodeTests, InterpolationAnimatedNodeColor) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  auto valueTag = ++rootTag;
+  auto interpolationTag = ++rootTag;
+
+  const auto black =
+      static_cast<int32_t>(hostPlatformColorFromRGBA(0, 0, 0, 255));
+  const auto white =
+      static_cast<int32_t>(hostPlatformColorFromRGBA(255, 255, 255, 255));
+  nodesManager_->createAnimatedNode(
+      valueTag,
+      folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+  nodesManager_->createAnimatedNode(
+      interpolationTag,
+      folly::dynamic::object("type", "interpolation")(
+          "inputRange", folly::dynamic::array(0, 1, 2))(
+          "outputRange", folly::dynamic::array(black, white, black))(
+          "outputType", "color")("extrapolateLeft", "extend")(
+          "extrapolateRight", "extend"));
+  nodesManager_->connectAnimatedNodes(valueTag, interpolationTag);
+
+  nodesManager_->setAnimatedNodeValue(valueTag, 1.5);
+  runAnimationFrame(0);
+  EXPECT_EQ(
+      nodesManager_->getValue(interpolationTag),
+      static_cast<int32_t>(hostPlatformColorFromRGBA(127, 127, 127, 255)));
+
+  nodesManager_->setAnimatedNodeValue(valueTag, 1);
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(interpolationTag), white);
+}
+
 TEST_F(AnimatedNodeTests, ObjectAnimatedNode) {
   initNodesManager();
 
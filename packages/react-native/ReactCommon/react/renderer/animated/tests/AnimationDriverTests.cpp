@@ -8,6 +8,7 @@
 #include "AnimationTestsBase.h"
 
 #include <react/renderer/animated/drivers/AnimationDriverUtils.h>
+#include <react/renderer/animated/drivers/SpringAnimationDriver.h>
 #include <react/renderer/core/ReactRootViewTagGenerator.h>
 
 namespace facebook::react {
@@ -58,4 +59,50 @@ TEST_F(AnimationDriverTests, framesAnimation) {
   EXPECT_EQ(round(nodesManager_->getValue(valueNodeTag).value()), toValue);
 }
 
+TEST_F(AnimationDriverTests, batchedSpringAnimationMatchesScalarDriver) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  auto batchedValueNodeTag = ++rootTag;
+  auto scalarValueNodeTag = ++rootTag;
+  for (auto tag : {batchedValueNodeTag, scalarValueNodeTag}) {
+    nodesManager_->createAnimatedNode(
+        tag, folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+  }
+
+  const auto toValue = 100;
+  const folly::dynamic config = folly::dynamic::object("type", "spring")(
+      "stiffness", 100)("damping", 10)("mass", 1)("initialVelocity", 0)(
+      "toValue", toValue)("restSpeedThreshold", 0.001)(
+      "restDisplacementThreshold", 0.001)("overshootClamping", false);
+
+  auto batchedDriver = SpringAnimationDriver(
+      1, batchedValueNodeTag, std::nullopt, config, nodesManager_.get());
+  batchedDriver.startAnimation();
+  auto scalarDriver = SpringAnimationDriver(
+      2, scalarValueNodeTag, std::nullopt, config, nodesManager_.get());
+  scalarDriver.startAnimation();
+
+  // The batch evaluates the curve with approximations of exp, sin and cos
+  auto batch = AnimationDriverBatch{};
+  const double startTimeInTick = 12345;
+  for (int frame = 0; frame < 300; frame++) {
+    const auto frameTime = startTimeInTick + SingleFrameIntervalMs * frame;
+    batch.reset(1);
+    batchedDriver.runAnimationStep(frameTime, batch);
+    batch.evaluate();
+    batchedDriver.finishAnimationStep(batch);
+    scalarDriver.runAnimationStep(frameTime);
+    EXPECT_NEAR(
+        nodesManager_->getValue(batchedValueNodeTag).value(),
+        nodesManager_->getValue(scalarValueNodeTag).value(),
+        1e-4);
+  }
+
+  EXPECT_EQ(nodesManager_->getValue(batchedValueNodeTag), toValue);
+  EXPECT_TRUE(batchedDriver.getIsComplete());
+  EXPECT_TRUE(scalarDriver.getIsComplete());
+}
+
 } // namespace facebook::react
@@ -29,6 +29,7 @@ class AnimationTestsBase : public testing::Test {
         [this](Tag reactTag, const folly::dynamic &changedProps) {
           lastUpdatedNodeTag = reactTag;
           lastCommittedProps = changedProps;
+          lastCommittedPropsObject = &changedProps;
         },
         [this](const std::unordered_map<Tag, folly::dynamic> &nodesProps) {
           if (!nodesProps.empty()) {
@@ -44,6 +45,18 @@ class AnimationTestsBase : public testing::Test {
     return nodesManager_->updatedNodeTags_.contains(nodeTag);
   }
 
+  // Returns the props object kept for the view after they were committed by
+  // direct manipulation, or `nullptr` if it was not kept.
+  const folly::dynamic *releasedDirectViewProps(Tag viewTag) const
+  {
+    for (const auto &node : nodesManager_->releasedViewPropsDirect_) {
+      if (node.key() == viewTag) {
+        return &node.mapped();
+      }
+    }
+    return nullptr;
+  }
+
   void runAnimationFrame(double timestamp)
   {
     nodesManager_->onAnimationFrame(timestamp);
@@ -51,6 +64,7 @@ class AnimationTestsBase : public testing::Test {
 
   std::shared_ptr<NativeAnimatedNodesManager> nodesManager_;
   folly::dynamic lastCommittedProps{folly::dynamic::object()};
+  const folly::dynamic *lastCommittedPropsObject{};
   Tag lastUpdatedNodeTag{};
 };
 
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+
+#include <memory>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr Tag kNodeCount = 1000;
+
+std::unique_ptr<NativeAnimatedNodesManager> makeNodesManager() {
+  auto nodesManager = std::make_unique<NativeAnimatedNodesManager>(
+      [](Tag /*viewTag*/, const folly::dynamic& /*props*/) {},
+      [](std::unordered_map<Tag, folly::dynamic>& /*props*/) {});
+  // Nodes can only be created on the render thread.
+  nodesManager->onRender();
+  return nodesManager;
+}
+
+void createValueNode(NativeAnimatedNodesManager& nodesManager, Tag tag) {
+  nodesManager.createAnimatedNode(
+      tag, folly::dynamic::object("type", "value")("value", 1)("offset", 0));
+}
+
+void createModulusNode(
+    NativeAnimatedNodesManager& nodesManager,
+    Tag tag,
+    Tag inputTag) {
+  nodesManager.createAnimatedNode(
+      tag,
+      folly::dynamic::object("type", "modulus")("input", inputTag)(
+          "modulus", 100));
+  nodesManager.connectAnimatedNodes(inputTag, tag);
+}
+
+void runFrames(
+    benchmark::State& state,
+    NativeAnimatedNodesManager& nodesManager,
+    Tag valueTag) {
+  nodesManager.updateNodes();
+  auto value = 0.0;
+  for (auto _ : state) {
+    nodesManager.setAnimatedNodeValue(valueTag, value++);
+    nodesManager.updateNodes();
+  }
+}
+
+} // namespace
+
+// A value driving a chain of nodes, each depending on the previous one.
+static void updateChain(benchmark::State& state) {
+  auto nodesManager = makeNodesManager();
+  createValueNode(*nodesManager, 1);
+  for (Tag tag = 2; tag <= kNodeCount; tag++) {
+    createModulusNode(*nodesManager, tag, tag - 1);
+  }
+  runFrames(state, *nodesManager, 1);
+}
+BENCHMARK(updateChain);
+
+// A value driving many nodes, e.g. a scroll position shared by many views.
+static void updateFanOut(benchmark::State& state) {
+  auto nodesManager = makeNodesManager();
+  createValueNode(*nodesManager, 1);
+  for (Tag tag = 2; tag <= kNodeCount; tag++) {
+    createModulusNode(*nodesManager, tag, 1);
+  }
+  runFrames(state, *nodesManager, 1);
+}
+BENCHMARK(updateFanOut);
+
+// Many independent animations of which only one runs.
+static void updateOneOfManyComponents(benchmark::State& state) {
+  auto nodesManager = makeNodesManager();
+  for (Tag tag = 1; tag < kNodeCount; tag += 2) {
+    createValueNode(*nodesManager, tag);
+    createModulusNode(*nodesManager, tag + 1, tag);
+  }
+  runFrames(state, *nodesManager, kNodeCount / 2 + 1);
+}
+BENCHMARK(updateOneOfManyComponents);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
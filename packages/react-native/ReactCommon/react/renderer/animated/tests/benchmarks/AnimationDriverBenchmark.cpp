@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/drivers/AnimationDriverBatch.h>
+#include <react/renderer/animated/drivers/AnimationDriverUtils.h>
+#include <react/renderer/animated/drivers/SpringAnimationDriver.h>
+
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+struct Animations {
+  std::unique_ptr<NativeAnimatedNodesManager> nodesManager;
+  std::vector<std::unique_ptr<AnimationDriver>> drivers;
+};
+
+Animations makeSpringAnimations(size_t count, const folly::dynamic& config) {
+  auto animations = Animations{};
+  animations.nodesManager = std::make_unique<NativeAnimatedNodesManager>(
+      [](Tag /*viewTag*/, const folly::dynamic& /*props*/) {},
+      [](std::unordered_map<Tag, folly::dynamic>& /*props*/) {});
+  // Nodes can only be created on the render thread.
+  animations.nodesManager->onRender();
+
+  for (size_t i = 0; i < count; i++) {
+    auto tag = static_cast<Tag>(i + 1);
+    animations.nodesManager->createAnimatedNode(
+        tag, folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+    auto driver = std::make_unique<SpringAnimationDriver>(
+        static_cast<int>(i),
+        tag,
+        std::nullopt,
+        config,
+        animations.nodesManager.get());
+    driver->startAnimation();
+    animations.drivers.push_back(std::move(driver));
+  }
+  return animations;
+}
+
+// Looping, so that the animations keep running.
+const folly::dynamic kSpringConfig = folly::dynamic::object("type", "spring")(
+    "stiffness", 100)("damping", 10)("mass", 1)("initialVelocity", 0)(
+    "toValue", 100)("restSpeedThreshold", 0.001)(
+    "restDisplacementThreshold", 0.001)("overshootClamping", false)(
+    "iterations", -1);
+
+void runScalar(benchmark::State& state, Animations& animations) {
+  auto frameTime = 0.0;
+  for (auto _ : state) {
+    for (auto& driver : animations.drivers) {
+      driver->runAnimationStep(frameTime);
+    }
+    frameTime += SingleFrameIntervalMs;
+  }
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<int64_t>(animations.drivers.size()));
+}
+
+void runBatched(benchmark::State& state, Animations& animations) {
+  auto batch = AnimationDriverBatch{};
+  auto frameTime = 0.0;
+  for (auto _ : state) {
+    batch.reset(animations.drivers.size());
+    for (auto& driver : animations.drivers) {
+      driver->runAnimationStep(frameTime, batch);
+    }
+    batch.evaluate();
+    for (auto& driver : animations.drivers) {
+      driver->finishAnimationStep(batch);
+    }
+    frameTime += SingleFrameIntervalMs;
+  }
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<int64_t>(animations.drivers.size()));
+}
+
+} // namespace
+
+static void springsScalar(benchmark::State& state) {
+  auto animations = makeSpringAnimations(
+      static_cast<size_t>(state.range(0)), kSpringConfig);
+  runScalar(state, animations);
+}
+BENCHMARK(springsScalar)->Arg(1)->Arg(100)->Arg(1000);
+
+static void springsBatched(benchmark::State& state) {
+  auto animations = makeSpringAnimations(
+      static_cast<size_t>(state.range(0)), kSpringConfig);
+  runBatched(state, animations);
+}
+BENCHMARK(springsBatched)->Arg(1)->Arg(100)->Arg(1000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -1082,7 +1082,8 @@ inline MapBuffer toMapBuffer(const FontVariant &fontVariant)
 
 inline MapBuffer toMapBuffer(const TextAttributes &textAttributes)
 {
-  auto builder = MapBufferBuilder();
+  auto pooledBuilder = PooledMapBufferBuilder();
+  auto &builder = *pooledBuilder;
   if (textAttributes.foregroundColor) {
     builder.putInt(TA_KEY_FOREGROUND_COLOR, toAndroidRepr(textAttributes.foregroundColor));
   }
@@ -1176,7 +1177,8 @@ inline MapBuffer toMapBuffer(const TextAttributes &textAttributes)
 
 inline MapBuffer toMapBuffer(const AttributedString::Fragment &fragment)
 {
-  auto builder = MapBufferBuilder();
+  auto pooledBuilder = PooledMapBufferBuilder();
+  auto &builder = *pooledBuilder;
 
   builder.putString(FR_KEY_STRING, fragment.string);
   if (fragment.parentShadowView.componentHandle) {
@@ -1195,14 +1197,16 @@ inline MapBuffer toMapBuffer(const AttributedString::Fragment &fragment)
 
 inline MapBuffer toMapBuffer(const AttributedString &attributedString)
 {
-  auto fragmentsBuilder = MapBufferBuilder();
+  auto pooledFragmentsBuilder = PooledMapBufferBuilder();
+  auto &fragmentsBuilder = *pooledFragmentsBuilder;
 
   int index = 0;
   for (auto fragment : attributedString.getFragments()) {
     fragmentsBuilder.putMapBuffer(index++, toMapBuffer(fragment));
   }
 
-  auto builder = MapBufferBuilder();
+  auto pooledBuilder = PooledMapBufferBuilder();
+  auto &builder = *pooledBuilder;
   size_t hash = std::hash<facebook::react::AttributedString>{}(attributedString);
   // TODO: This truncates half the hash
   builder.putInt(AS_KEY_HASH, static_cast<int>(hash));
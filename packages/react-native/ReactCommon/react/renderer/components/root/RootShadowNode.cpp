@@ -9,6 +9,7 @@
 
 #include <cxxreact/TraceSection.h>
 #include <react/renderer/components/view/conversions.h>
+#include <react/utils/hash_combine.h>
 
 namespace facebook::react {
 
@@ -62,4 +63,67 @@ void RootShadowNode::setInstanceHandle(
   getFamily().setInstanceHandle(instanceHandle);
 }
 
+size_t RootShadowNode::LayoutMetricsKeyHash::operator()(
+    const LayoutMetricsKey& key) const {
+  return hash_combine(key.family, key.policy);
+}
+
+std::shared_ptr<const ShadowNode> RootShadowNode::getDescendantShadowNode(
+    const ShadowNodeFamily& family) const {
+  // A tree which is not laid out yet may still be mutated in place.
+  auto isMemoizable = getIsLayoutClean();
+
+  if (isMemoizable) {
+    std::scoped_lock lock(memoizationMutex_);
+    auto iterator = descendantShadowNodes_.find(&family);
+    if (iterator != descendantShadowNodes_.end()) {
+      return iterator->second;
+    }
+  }
+
+  auto descendantShadowNode = std::shared_ptr<const ShadowNode>{};
+  auto ancestors = family.getAncestors(*this);
+  if (!ancestors.empty()) {
+    auto& pair = ancestors.back();
+    descendantShadowNode = pair.first.get().getChildren().at(pair.second);
+  }
+
+  if (isMemoizable) {
+    std::scoped_lock lock(memoizationMutex_);
+    descendantShadowNodes_.emplace(&family, descendantShadowNode);
+  }
+
+  return descendantShadowNode;
+}
+
+LayoutMetrics RootShadowNode::getLayoutMetricsOfDescendant(
+    const ShadowNodeFamily& family,
+    LayoutInspectingPolicy policy) const {
+  auto isMemoizable = getIsLayoutClean();
+  auto key = LayoutMetricsKey{
+      .family = &family,
+      .policy = static_cast<uint8_t>(
+          (policy.includeTransform ? 1 : 0) |
+          (policy.includeViewportOffset ? 2 : 0) |
+          (policy.enableOverflowClipping ? 4 : 0))};
+
+  if (isMemoizable) {
+    std::scoped_lock lock(memoizationMutex_);
+    auto iterator = descendantLayoutMetrics_.find(key);
+    if (iterator != descendantLayoutMetrics_.end()) {
+      return iterator->second;
+    }
+  }
+
+  auto layoutMetrics =
+      LayoutableShadowNode::computeLayoutMetricsFromRoot(family, *this, policy);
+
+  if (isMemoizable) {
+    std::scoped_lock lock(memoizationMutex_);
+    descendantLayoutMetrics_.emplace(key, layoutMetrics);
+  }
+
+  return layoutMetrics;
+}
+
 } // namespace facebook::react
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <react/renderer/components/root/RootProps.h>
 #include <react/renderer/components/view/ConcreteViewShadowNode.h>
@@ -57,6 +59,43 @@ class RootShadowNode final : public ConcreteViewShadowNode<RootComponentName, Ro
   Transform getTransform() const override;
 
   void setInstanceHandle(InstanceHandle::Shared instanceHandle) const;
+
+  /*
+   * Returns the node of the given family in this revision of the tree, or
+   * `nullptr` if the family has no node in it.
+   * Once the tree is laid out, results are memoized for the lifetime of this
+   * revision.
+   */
+  std::shared_ptr<const ShadowNode> getDescendantShadowNode(const ShadowNodeFamily &family) const;
+
+  /*
+   * Same as `LayoutableShadowNode::computeLayoutMetricsFromRoot` with this node
+   * as the root.
+   * Once the tree is laid out, results are memoized for the lifetime of this
+   * revision, so repeated measurements of the same node are O(1).
+   */
+  LayoutMetrics getLayoutMetricsOfDescendant(const ShadowNodeFamily &family, LayoutInspectingPolicy policy) const;
+
+ private:
+  struct LayoutMetricsKey {
+    const ShadowNodeFamily *family;
+    uint8_t policy;
+
+    bool operator==(const LayoutMetricsKey &rhs) const = default;
+  };
+
+  struct LayoutMetricsKeyHash {
+    size_t operator()(const LayoutMetricsKey &key) const;
+  };
+
+  /*
+   * A revision of the tree is immutable after layout, so nodes and layout
+   * metrics looked up in it never go stale. The tables are lazily populated
+   * and are dropped together with the revision.
+   */
+  mutable std::mutex memoizationMutex_;
+  mutable std::unordered_map<const ShadowNodeFamily *, std::shared_ptr<const ShadowNode>> descendantShadowNodes_;
+  mutable std::unordered_map<LayoutMetricsKey, LayoutMetrics, LayoutMetricsKeyHash> descendantLayoutMetrics_;
 };
 
 } // namespace facebook::react
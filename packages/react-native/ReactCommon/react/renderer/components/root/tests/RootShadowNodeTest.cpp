@@ -15,6 +15,26 @@
 
 namespace facebook::react {
 
+namespace {
+
+std::shared_ptr<const ViewShadowNodeProps> viewPropsWithFrame(Rect frame) {
+  auto props = std::make_shared<ViewShadowNodeProps>();
+  auto& yogaStyle = props->yogaStyle;
+  yogaStyle.setPositionType(yoga::PositionType::Absolute);
+  yogaStyle.setPosition(
+      yoga::Edge::Left, yoga::StyleLength::points(frame.origin.x));
+  yogaStyle.setPosition(
+      yoga::Edge::Top, yoga::StyleLength::points(frame.origin.y));
+  yogaStyle.setDimension(
+      yoga::Dimension::Width, yoga::StyleSizeLength::points(frame.size.width));
+  yogaStyle.setDimension(
+      yoga::Dimension::Height,
+      yoga::StyleSizeLength::points(frame.size.height));
+  return props;
+}
+
+} // namespace
+
 TEST(RootShadowNodeTest, cloneWithLayoutConstraints) {
   ContextContainer contextContainer{};
   PropsParserContext parserContext{-1, contextContainer};
@@ -43,4 +63,103 @@ TEST(RootShadowNodeTest, cloneWithLayoutConstraints) {
   EXPECT_TRUE(clonedWithDifferentLayoutConstraints->layoutIfNeeded());
 }
 
+TEST(RootShadowNodeTest, memoizesDescendantsWithinRevision) {
+  auto builder = simpleComponentBuilder();
+  std::shared_ptr<ViewShadowNode> parentShadowNode;
+  std::shared_ptr<ViewShadowNode> childShadowNode;
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .props([] {
+          auto sharedProps = std::make_shared<RootProps>();
+          sharedProps->layoutConstraints = LayoutConstraints{
+              .minimumSize = {.width = 400, .height = 800},
+              .maximumSize = {.width = 400, .height = 800}};
+          return sharedProps;
+        })
+        .children({
+          Element<ViewShadowNode>()
+            .reference(parentShadowNode)
+            .props([] {
+              return viewPropsWithFrame(
+                  {.origin = {.x = 10, .y = 20},
+                   .size = {.width = 200, .height = 200}});
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .reference(childShadowNode)
+                .props([] {
+                  return viewPropsWithFrame(
+                      {.origin = {.x = 5, .y = 5},
+                       .size = {.width = 50, .height = 50}});
+                })
+            })
+        });
+  // clang-format on
+
+  auto rootShadowNode = builder.build(element);
+  rootShadowNode->layoutIfNeeded();
+  ASSERT_TRUE(rootShadowNode->getIsLayoutClean());
+
+  const auto& childFamily = childShadowNode->getFamily();
+  auto descendantShadowNode =
+      rootShadowNode->getDescendantShadowNode(childFamily);
+  ASSERT_NE(descendantShadowNode, nullptr);
+  EXPECT_EQ(
+      rootShadowNode->getDescendantShadowNode(childFamily),
+      descendantShadowNode);
+  EXPECT_EQ(
+      rootShadowNode->getDescendantShadowNode(rootShadowNode->getFamily()),
+      nullptr);
+
+  for (auto includeTransform : {false, true}) {
+    for (auto includeViewportOffset : {false, true}) {
+      auto policy = LayoutableShadowNode::LayoutInspectingPolicy{
+          .includeTransform = includeTransform,
+          .includeViewportOffset = includeViewportOffset};
+      for (const auto* family :
+           {&rootShadowNode->getFamily(),
+            &parentShadowNode->getFamily(),
+            &childFamily}) {
+        auto expected = LayoutableShadowNode::computeLayoutMetricsFromRoot(
+            *family, *rootShadowNode, policy);
+        EXPECT_EQ(
+            rootShadowNode->getLayoutMetricsOfDescendant(*family, policy),
+            expected);
+        EXPECT_EQ(
+            rootShadowNode->getLayoutMetricsOfDescendant(*family, policy),
+            expected);
+      }
+    }
+  }
+
+  EXPECT_EQ(
+      rootShadowNode->getLayoutMetricsOfDescendant(childFamily, {}).frame,
+      (Rect{.origin = {.x = 15, .y = 25}, .size = {.width = 50, .height = 50}}));
+
+  // A new revision does not see the measurements of the previous one.
+  auto newRootShadowNode =
+      std::static_pointer_cast<RootShadowNode>(rootShadowNode->cloneTree(
+          parentShadowNode->getFamily(), [](const ShadowNode& oldShadowNode) {
+            return oldShadowNode.clone(
+                {.props = viewPropsWithFrame(
+                     {.origin = {.x = 100, .y = 200},
+                      .size = {.width = 200, .height = 200}})});
+          }));
+  newRootShadowNode->layoutIfNeeded();
+
+  EXPECT_NE(
+      newRootShadowNode->getDescendantShadowNode(childFamily),
+      descendantShadowNode);
+  EXPECT_EQ(
+      newRootShadowNode->getLayoutMetricsOfDescendant(childFamily, {}).frame,
+      (Rect{
+          .origin = {.x = 105, .y = 205},
+          .size = {.width = 50, .height = 50}}));
+  EXPECT_EQ(
+      rootShadowNode->getLayoutMetricsOfDescendant(childFamily, {}).frame,
+      (Rect{.origin = {.x = 15, .y = 25}, .size = {.width = 50, .height = 50}}));
+}
+
 } // namespace facebook::react
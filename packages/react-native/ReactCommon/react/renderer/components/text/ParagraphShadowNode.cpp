@@ -62,9 +62,19 @@ ParagraphShadowNode::ParagraphShadowNode(
 }
 
 bool ParagraphShadowNode::shouldNewRevisionDirtyMeasurement(
-    const ShadowNode& /*sourceShadowNode*/,
+    const ShadowNode& sourceShadowNode,
     const ShadowNodeFragment& fragment) const {
-  return fragment.props != nullptr;
+  if (fragment.props == nullptr) {
+    return false;
+  }
+
+  // Only text and paragraph attributes affect the measured content; changes
+  // of the Yoga style dirty the node in `updateYogaProps` anyway.
+  const auto& oldProps =
+      static_cast<const ParagraphProps&>(*sourceShadowNode.getProps());
+  const auto& newProps = static_cast<const ParagraphProps&>(*fragment.props);
+  return !(oldProps.textAttributes == newProps.textAttributes) ||
+      oldProps.paragraphAttributes != newProps.paragraphAttributes;
 }
 
 const Content& ParagraphShadowNode::getContent(
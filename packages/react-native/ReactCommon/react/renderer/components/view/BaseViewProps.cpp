@@ -466,6 +466,27 @@ void BaseViewProps::setProp(
   }
 }
 
+bool BaseViewProps::canSetPropIncrementally(RawPropsPropNameHash hash) {
+  // Props that animations update often, for which `setProp` uses the same
+  // name, conversion and default value as the constructor.
+  switch (hash) {
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("opacity"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("backgroundColor"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("transform"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("backfaceVisibility"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("zIndex"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("pointerEvents"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("shadowColor"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("shadowOpacity"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("outlineColor"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("outlineOffset"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("outlineWidth"):
+      return true;
+    default:
+      return false;
+  }
+}
+
 #pragma mark - Convenience Methods
 
 static BorderRadii ensureNoOverlap(const BorderRadii& radii, const Size& size) {
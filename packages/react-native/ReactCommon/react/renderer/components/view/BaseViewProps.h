@@ -40,6 +40,12 @@ class BaseViewProps : public YogaStylableProps, public AccessibilityProps {
   void
   setProp(const PropsParserContext &context, RawPropsPropNameHash hash, const char *propName, const RawValue &value);
 
+  /*
+   * Returns `true` if `setProp` applies the prop with the same result as the
+   * parsing constructor. See `RawPropsIncrementallySettable`.
+   */
+  static bool canSetPropIncrementally(RawPropsPropNameHash hash);
+
 #pragma mark - Props
 
   // Color
@@ -36,6 +36,11 @@ class ViewShadowNode final : public ConcreteViewShadowNode<ViewComponentName, Vi
 
   ViewShadowNode(const ShadowNode &sourceShadowNode, const ShadowNodeFragment &fragment);
 
+  static bool canSetPropIncrementally(RawPropsPropNameHash hash)
+  {
+    return ViewShadowNodeProps::canSetPropIncrementally(hash);
+  }
+
  private:
   void initialize() noexcept;
 };
@@ -21,6 +21,7 @@
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 #include <react/utils/FloatComparison.h>
 #include <yoga/Yoga.h>
+#include <yoga/algorithm/CalculateLayout.h>
 #include <algorithm>
 #include <limits>
 #include <memory>
@@ -142,6 +143,11 @@ YogaLayoutableShadowNode::YogaLayoutableShadowNode(
             .yogaTreeHasBeenConfigured_;
   }
 
+  // Measurements survive the cloning unless `completeClone` invalidates them.
+  measurementCache_ =
+      static_cast<const YogaLayoutableShadowNode&>(sourceShadowNode)
+          .measurementCache_;
+
   if (fragment.props) {
     updateYogaProps();
   }
@@ -154,14 +160,15 @@ YogaLayoutableShadowNode::YogaLayoutableShadowNode(
 }
 
 void YogaLayoutableShadowNode::completeClone(
-    const ShadowNode& /*sourceShadowNode*/,
+    const ShadowNode& sourceShadowNode,
     const ShadowNodeFragment& fragment) {
   if (getTraits().check(ShadowNodeTraits::Trait::MeasurableYogaNode) &&
       // New children means we must always dirty to visit. Otherwise, ask the
       // Node if the new revision invalidates measurement.
       (fragment.children ||
-       shouldNewRevisionDirtyMeasurement(*this, fragment))) {
+       shouldNewRevisionDirtyMeasurement(sourceShadowNode, fragment))) {
     yogaNode_.setDirty(true);
+    measurementCache_ = nullptr;
   }
 }
 
@@ -658,7 +665,11 @@ void YogaLayoutableShadowNode::layoutTree(
 
   {
     TraceSection s3("YogaLayoutableShadowNode::YGNodeCalculateLayout");
-    YGNodeCalculateLayout(&yogaNode_, ownerWidth, ownerHeight, direction);
+    // Same as `YGNodeCalculateLayout`, but keeps the counters of the layout
+    // pass.
+    auto layoutData = yoga::calculateLayout(
+        &yogaNode_, ownerWidth, ownerHeight, yoga::scopedEnum(direction));
+    YogaMeasurementCache::reportLayoutPass(layoutData);
   }
 
   // Update layout metrics for root node. Updated for children in
@@ -844,6 +855,24 @@ YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
       break;
   }
 
+  auto measurementCacheKey = YogaMeasurementCache::makeKey(
+      width,
+      widthMode,
+      height,
+      heightMode,
+      YGNodeLayoutGetDirection(yogaNode),
+      threadLocalLayoutContext);
+  if (shadowNode.measurementCache_) {
+    if (auto cachedSize =
+            shadowNode.measurementCache_->get(measurementCacheKey)) {
+      return YGSize{
+          yogaFloatFromFloat(cachedSize->width),
+          yogaFloatFromFloat(cachedSize->height)};
+    }
+  } else {
+    shadowNode.measurementCache_ = std::make_shared<YogaMeasurementCache>();
+  }
+
   auto size = shadowNode.measureContent(
       threadLocalLayoutContext,
       {.minimumSize = minimumSize, .maximumSize = maximumSize});
@@ -863,6 +892,8 @@ YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
   }
 #endif
 
+  shadowNode.measurementCache_->set(measurementCacheKey, size);
+
   return YGSize{
       yogaFloatFromFloat(size.width), yogaFloatFromFloat(size.height)};
 }
@@ -13,6 +13,7 @@
 #include <yoga/node/Node.h>
 
 #include <react/debug/react_native_assert.h>
+#include <react/renderer/components/view/YogaMeasurementCache.h>
 #include <react/renderer/components/view/YogaStylableProps.h>
 #include <react/renderer/core/LayoutableShadowNode.h>
 #include <react/renderer/core/Sealable.h>
@@ -215,6 +216,12 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
    * Whether the full Yoga subtree of this Node has been configured.
    */
   bool yogaTreeHasBeenConfigured_{false};
+
+  /*
+   * Measurements of a measurable node, shared with the clones which don't
+   * invalidate them. Created on the first measurement.
+   */
+  std::shared_ptr<YogaMeasurementCache> measurementCache_;
 };
 
 } // namespace facebook::react
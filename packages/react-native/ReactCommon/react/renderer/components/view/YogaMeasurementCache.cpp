@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YogaMeasurementCache.h"
+
+#include <jsinspector-modern/tracing/PerformanceTracer.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace facebook::react {
+
+namespace {
+
+std::atomic<uint64_t> layoutCount{0};
+std::atomic<uint64_t> cachedLayoutCount{0};
+std::atomic<uint64_t> measureCount{0};
+std::atomic<uint64_t> cachedMeasureCount{0};
+std::atomic<uint64_t> measurementCacheHitCount{0};
+std::atomic<uint64_t> measurementCacheMissCount{0};
+
+double hitRate(uint64_t hitCount, uint64_t missCount) {
+  auto totalCount = hitCount + missCount;
+  return totalCount == 0 ? 0.0
+                         : static_cast<double>(hitCount) /
+          static_cast<double>(totalCount);
+}
+
+} // namespace
+
+YogaMeasurementCache::Key YogaMeasurementCache::makeKey(
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode,
+    YGDirection direction,
+    const LayoutContext& layoutContext) {
+  // Undefined dimensions are passed as NaN, which doesn't compare equal to
+  // itself.
+  return Key{
+      .width = widthMode == YGMeasureModeUndefined ? 0 : width,
+      .widthMode = widthMode,
+      .height = heightMode == YGMeasureModeUndefined ? 0 : height,
+      .heightMode = heightMode,
+      .direction = direction,
+      .fontSizeMultiplier = layoutContext.fontSizeMultiplier,
+      .pointScaleFactor = layoutContext.pointScaleFactor,
+      .swapLeftAndRightInRTL = layoutContext.swapLeftAndRightInRTL};
+}
+
+std::optional<Size> YogaMeasurementCache::get(const Key& key) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < entryCount_; i++) {
+    if (entries_[i].key == key) {
+      measurementCacheHitCount.fetch_add(1, std::memory_order_relaxed);
+      return entries_[i].size;
+    }
+  }
+  measurementCacheMissCount.fetch_add(1, std::memory_order_relaxed);
+  return std::nullopt;
+}
+
+void YogaMeasurementCache::set(const Key& key, Size size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < entryCount_; i++) {
+    if (entries_[i].key == key) {
+      entries_[i].size = size;
+      return;
+    }
+  }
+
+  // Same as Yoga's own cache, the oldest entry is overwritten when the cache
+  // is full.
+  entries_[nextEntryIndex_] = Entry{.key = key, .size = size};
+  nextEntryIndex_ = (nextEntryIndex_ + 1) % MaxEntries;
+  entryCount_ = std::min(entryCount_ + 1, MaxEntries);
+}
+
+void YogaMeasurementCache::reportLayoutPass(
+    const yoga::LayoutData& layoutData) {
+  layoutCount.fetch_add(layoutData.layouts, std::memory_order_relaxed);
+  cachedLayoutCount.fetch_add(
+      layoutData.cachedLayouts, std::memory_order_relaxed);
+  measureCount.fetch_add(layoutData.measures, std::memory_order_relaxed);
+  cachedMeasureCount.fetch_add(
+      layoutData.cachedMeasures, std::memory_order_relaxed);
+
+  auto& performanceTracer =
+      jsinspector_modern::tracing::PerformanceTracer::getInstance();
+  if (!performanceTracer.isTracing()) {
+    return;
+  }
+
+  auto statistics = getStatistics();
+  auto detail = folly::dynamic::object("layoutCount", layoutData.layouts)(
+      "cachedLayoutCount", layoutData.cachedLayouts)(
+      "measureCount", layoutData.measures)(
+      "cachedMeasureCount", layoutData.cachedMeasures)(
+      "measureCallbackCount", layoutData.measureCallbacks)(
+      "layoutCacheHitRate",
+      hitRate(statistics.cachedLayoutCount, statistics.layoutCount))(
+      "measureCacheHitRate",
+      hitRate(statistics.cachedMeasureCount, statistics.measureCount))(
+      "measurementCacheHitRate",
+      hitRate(
+          statistics.measurementCacheHitCount,
+          statistics.measurementCacheMissCount));
+
+  performanceTracer.reportTimeStamp(
+      "Yoga Layout Pass",
+      HighResTimeStamp::now(),
+      std::nullopt,
+      "Yoga Layout Cache",
+      std::nullopt,
+      std::nullopt,
+      std::move(detail));
+}
+
+YogaLayoutCacheStatistics YogaMeasurementCache::getStatistics() {
+  return YogaLayoutCacheStatistics{
+      .layoutCount = layoutCount.load(std::memory_order_relaxed),
+      .cachedLayoutCount = cachedLayoutCount.load(std::memory_order_relaxed),
+      .measureCount = measureCount.load(std::memory_order_relaxed),
+      .cachedMeasureCount = cachedMeasureCount.load(std::memory_order_relaxed),
+      .measurementCacheHitCount =
+          measurementCacheHitCount.load(std::memory_order_relaxed),
+      .measurementCacheMissCount =
+          measurementCacheMissCount.load(std::memory_order_relaxed)};
+}
+
+} // namespace facebook::react
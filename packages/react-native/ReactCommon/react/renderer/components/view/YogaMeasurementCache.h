@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include <react/renderer/core/LayoutContext.h>
+#include <react/renderer/graphics/Size.h>
+#include <yoga/Yoga.h>
+#include <yoga/event/event.h>
+
+namespace facebook::react {
+
+/*
+ * Aggregated effectiveness of Yoga's own per-node caches and of
+ * `YogaMeasurementCache` since the app started.
+ */
+struct YogaLayoutCacheStatistics {
+  uint64_t layoutCount{0};
+  uint64_t cachedLayoutCount{0};
+  uint64_t measureCount{0};
+  uint64_t cachedMeasureCount{0};
+  uint64_t measurementCacheHitCount{0};
+  uint64_t measurementCacheMissCount{0};
+};
+
+/*
+ * Cache of results of the measure function of a measurable Yoga leaf node,
+ * keyed by the measure constraints and the relevant parts of `LayoutContext`.
+ *
+ * Yoga keeps up to `LayoutResults::MaxCachedMeasurements` measurements per
+ * node, but drops them whenever the node is dirtied, e.g. because its style
+ * changed, even if the measured content didn't. A node shares its instance with
+ * the clones that don't invalidate its measurement (see
+ * `YogaLayoutableShadowNode::shouldNewRevisionDirtyMeasurement`), so the
+ * measurements survive such changes across commits.
+ *
+ * Clones of a node may be laid out concurrently, so the cache is thread-safe.
+ */
+class YogaMeasurementCache final {
+ public:
+  static constexpr size_t MaxEntries = 16;
+
+  struct Key {
+    float width{0};
+    YGMeasureMode widthMode{YGMeasureModeUndefined};
+    float height{0};
+    YGMeasureMode heightMode{YGMeasureModeUndefined};
+    YGDirection direction{YGDirectionInherit};
+    Float fontSizeMultiplier{1};
+    Float pointScaleFactor{1};
+    bool swapLeftAndRightInRTL{false};
+
+    bool operator==(const Key &rhs) const = default;
+  };
+
+  /*
+   * Builds a key from the arguments of a Yoga measure function.
+   */
+  static Key makeKey(
+      float width,
+      YGMeasureMode widthMode,
+      float height,
+      YGMeasureMode heightMode,
+      YGDirection direction,
+      const LayoutContext &layoutContext);
+
+  std::optional<Size> get(const Key &key) const;
+
+  void set(const Key &key, Size size);
+
+  /*
+   * Adds the counters of a Yoga layout pass to the cache statistics; while a
+   * performance trace is being recorded, they are also reported on the
+   * timeline.
+   */
+  static void reportLayoutPass(const yoga::LayoutData &layoutData);
+
+  static YogaLayoutCacheStatistics getStatistics();
+
+ private:
+  struct Entry {
+    Key key;
+    Size size;
+  };
+
+  mutable std::mutex mutex_;
+  std::array<Entry, MaxEntries> entries_{};
+  size_t entryCount_{0};
+  size_t nextEntryIndex_{0};
+};
+
+} // namespace facebook::react
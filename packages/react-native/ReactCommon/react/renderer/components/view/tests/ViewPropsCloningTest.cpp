@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawPropsParser.h>
+
+namespace facebook::react {
+
+namespace {
+
+// View props which count how they were created, to tell the incremental
+// cloning apart from parsing every prop.
+class CountingViewProps final : public ViewProps {
+ public:
+  CountingViewProps() = default;
+  CountingViewProps(
+      const PropsParserContext& context,
+      const CountingViewProps& sourceProps,
+      const RawProps& rawProps)
+      : ViewProps(context, sourceProps, rawProps) {
+    parseCount++;
+  }
+
+  void setProp(
+      const PropsParserContext& context,
+      RawPropsPropNameHash hash,
+      const char* propName,
+      const RawValue& value) {
+    ViewProps::setProp(context, hash, propName, value);
+    setPropCount++;
+  }
+
+  static inline int parseCount{0};
+  static inline int setPropCount{0};
+};
+
+const char CountingViewComponentName[] = "CountingView";
+
+class CountingViewShadowNode final
+    : public ConcreteViewShadowNode<
+          CountingViewComponentName,
+          CountingViewProps> {
+ public:
+  using ConcreteViewShadowNode::ConcreteViewShadowNode;
+
+  static bool canSetPropIncrementally(RawPropsPropNameHash hash) {
+    return CountingViewProps::canSetPropIncrementally(hash);
+  }
+};
+
+using CountingViewComponentDescriptor =
+    ConcreteComponentDescriptor<CountingViewShadowNode>;
+
+} // namespace
+
+// Props cloned by `ViewComponentDescriptor` may only be updated with
+// `setProp`, which must give the same result as parsing every prop.
+class ViewPropsCloningTest : public ::testing::Test {
+ protected:
+  ViewPropsCloningTest()
+      : componentDescriptor_(ComponentDescriptorParameters{
+            .eventDispatcher = {},
+            .contextContainer = nullptr,
+            .flavor = nullptr}) {
+    parser_.prepare<ViewShadowNodeProps>();
+    sourceProps_ = parse(
+        folly::dynamic::object("nativeID", "view")("opacity", 0.3)(
+            "backgroundColor", 0xff00ff00)(
+            "transform",
+            folly::dynamic::array(
+                folly::dynamic::object("rotate", "45deg"),
+                folly::dynamic::object("scale", 2)))("zIndex", 2)(
+            "pointerEvents", "box-none")("shadowColor", 0xff0000ff)(
+            "shadowOpacity", 0.5)("shadowRadius", 8)("outlineWidth", 2)(
+            "borderRadius", 4)("width", 100)("height", 50)("margin", 5),
+        nullptr);
+  }
+
+  std::shared_ptr<const ViewShadowNodeProps> clone(folly::dynamic dynamic) {
+    return std::static_pointer_cast<const ViewShadowNodeProps>(
+        componentDescriptor_.cloneProps(
+            parserContext_, sourceProps_, RawProps(std::move(dynamic))));
+  }
+
+  std::shared_ptr<const ViewShadowNodeProps> parse(
+      folly::dynamic dynamic,
+      const Props::Shared& sourceProps) {
+    auto rawProps = RawProps(std::move(dynamic));
+    rawProps.parse(parser_);
+    return ViewShadowNode::Props(parserContext_, rawProps, sourceProps);
+  }
+
+  void expectSameAsParsing(const folly::dynamic& dynamic) {
+    auto clonedProps = clone(dynamic);
+    auto parsedProps = parse(dynamic, sourceProps_);
+
+    EXPECT_NE(clonedProps, sourceProps_);
+    EXPECT_EQ(clonedProps->nativeId, parsedProps->nativeId);
+    EXPECT_EQ(clonedProps->opacity, parsedProps->opacity);
+    EXPECT_EQ(clonedProps->backgroundColor, parsedProps->backgroundColor);
+    EXPECT_EQ(clonedProps->transform, parsedProps->transform);
+    EXPECT_EQ(clonedProps->backfaceVisibility, parsedProps->backfaceVisibility);
+    EXPECT_EQ(clonedProps->zIndex, parsedProps->zIndex);
+    EXPECT_EQ(clonedProps->pointerEvents, parsedProps->pointerEvents);
+    EXPECT_EQ(clonedProps->shadowColor, parsedProps->shadowColor);
+    EXPECT_EQ(clonedProps->shadowOpacity, parsedProps->shadowOpacity);
+    EXPECT_EQ(clonedProps->shadowRadius, parsedProps->shadowRadius);
+    EXPECT_EQ(clonedProps->shadowOffset, parsedProps->shadowOffset);
+    EXPECT_EQ(clonedProps->outlineColor, parsedProps->outlineColor);
+    EXPECT_EQ(clonedProps->outlineOffset, parsedProps->outlineOffset);
+    EXPECT_EQ(clonedProps->outlineWidth, parsedProps->outlineWidth);
+    EXPECT_EQ(clonedProps->borderRadii, parsedProps->borderRadii);
+    EXPECT_EQ(clonedProps->yogaStyle, parsedProps->yogaStyle);
+    EXPECT_EQ(clonedProps->collapsable, parsedProps->collapsable);
+  }
+
+  ContextContainer contextContainer_{};
+  PropsParserContext parserContext_{-1, contextContainer_};
+  ViewComponentDescriptor componentDescriptor_;
+  RawPropsParser parser_{};
+  Props::Shared sourceProps_;
+};
+
+TEST_F(ViewPropsCloningTest, updatedPropsMatchParsing) {
+  expectSameAsParsing(folly::dynamic::object("opacity", 0.7));
+  expectSameAsParsing(folly::dynamic::object("backgroundColor", 0xffff0000));
+  expectSameAsParsing(folly::dynamic::object(
+      "transform",
+      folly::dynamic::array(folly::dynamic::object("translateX", 10))));
+  expectSameAsParsing(
+      folly::dynamic::object("zIndex", 5)("pointerEvents", "none")(
+          "backfaceVisibility", "hidden")("shadowColor", 0xff000000)(
+          "shadowOpacity", 0.1)("outlineColor", 0xff00ffff)(
+          "outlineOffset", 1)("outlineWidth", 3));
+}
+
+TEST_F(ViewPropsCloningTest, removedPropsMatchParsing) {
+  expectSameAsParsing(folly::dynamic::object("opacity", nullptr));
+  expectSameAsParsing(
+      folly::dynamic::object("backgroundColor", nullptr)("transform", nullptr)(
+          "zIndex", nullptr)("pointerEvents", nullptr)("shadowColor", nullptr)(
+          "shadowOpacity", nullptr)("outlineWidth", nullptr));
+}
+
+TEST_F(ViewPropsCloningTest, otherPropsMatchParsing) {
+  expectSameAsParsing(folly::dynamic::object("width", 20));
+  expectSameAsParsing(folly::dynamic::object("opacity", 0.7)("width", 20));
+  expectSameAsParsing(folly::dynamic::object("shadowRadius", nullptr));
+  expectSameAsParsing(folly::dynamic::object("unknownProp", 1));
+}
+
+TEST_F(ViewPropsCloningTest, invalidValuesMatchParsing) {
+  expectSameAsParsing(folly::dynamic::object("opacity", "invalid"));
+  expectSameAsParsing(
+      folly::dynamic::object("zIndex", 3)("opacity", folly::dynamic::array()));
+}
+
+TEST_F(ViewPropsCloningTest, sourcePropsAreNotModified) {
+  auto clonedProps = clone(folly::dynamic::object("opacity", 0.9));
+  auto& sourceProps = static_cast<const ViewShadowNodeProps&>(*sourceProps_);
+
+  EXPECT_EQ(clonedProps->opacity, (Float)0.9);
+  EXPECT_EQ(sourceProps.opacity, (Float)0.3);
+  EXPECT_EQ(clonedProps->nativeId, "view");
+  EXPECT_EQ(clonedProps->transform, sourceProps.transform);
+}
+
+TEST_F(ViewPropsCloningTest, changedPropsAreSetWithoutParsing) {
+  auto componentDescriptor =
+      CountingViewComponentDescriptor(ComponentDescriptorParameters{
+          .eventDispatcher = {},
+          .contextContainer = nullptr,
+          .flavor = nullptr});
+  auto sourceProps = componentDescriptor.cloneProps(
+      parserContext_,
+      nullptr,
+      RawProps(folly::dynamic::object("opacity", 0.3)("width", 100)));
+
+  CountingViewProps::parseCount = 0;
+  CountingViewProps::setPropCount = 0;
+  auto clonedProps = std::static_pointer_cast<const CountingViewProps>(
+      componentDescriptor.cloneProps(
+          parserContext_,
+          sourceProps,
+          RawProps(folly::dynamic::object("opacity", 0.7)(
+              "backgroundColor", 0xffff0000))));
+
+  EXPECT_EQ(CountingViewProps::parseCount, 0);
+  EXPECT_EQ(CountingViewProps::setPropCount, 2);
+  EXPECT_EQ(clonedProps->opacity, (Float)0.7);
+  EXPECT_EQ(
+      clonedProps->yogaStyle.dimension(yoga::Dimension::Width),
+      yoga::StyleSizeLength::points(100));
+
+  CountingViewProps::parseCount = 0;
+  CountingViewProps::setPropCount = 0;
+  componentDescriptor.cloneProps(
+      parserContext_,
+      sourceProps,
+      RawProps(folly::dynamic::object("opacity", 0.7)("width", 20)));
+
+  EXPECT_EQ(CountingViewProps::parseCount, 1);
+  EXPECT_EQ(CountingViewProps::setPropCount, 0);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/YogaMeasurementCache.h>
+
+namespace facebook::react {
+
+namespace {
+
+YogaMeasurementCache::Key makeKey(float width, YGMeasureMode widthMode) {
+  return YogaMeasurementCache::makeKey(
+      width,
+      widthMode,
+      YGUndefined,
+      YGMeasureModeUndefined,
+      YGDirectionLTR,
+      LayoutContext{});
+}
+
+} // namespace
+
+TEST(YogaMeasurementCacheTest, returnsStoredMeasurement) {
+  auto cache = YogaMeasurementCache{};
+  auto key = makeKey(100, YGMeasureModeAtMost);
+
+  EXPECT_FALSE(cache.get(key).has_value());
+
+  cache.set(key, Size{.width = 80, .height = 20});
+
+  auto size = cache.get(key);
+  ASSERT_TRUE(size.has_value());
+  EXPECT_EQ(size->width, 80);
+  EXPECT_EQ(size->height, 20);
+  EXPECT_FALSE(cache.get(makeKey(100, YGMeasureModeExactly)).has_value());
+  EXPECT_FALSE(cache.get(makeKey(90, YGMeasureModeAtMost)).has_value());
+}
+
+TEST(YogaMeasurementCacheTest, undefinedDimensionsMatch) {
+  auto cache = YogaMeasurementCache{};
+  cache.set(
+      makeKey(YGUndefined, YGMeasureModeUndefined),
+      Size{.width = 120, .height = 20});
+
+  EXPECT_TRUE(
+      cache.get(makeKey(YGUndefined, YGMeasureModeUndefined)).has_value());
+}
+
+TEST(YogaMeasurementCacheTest, layoutContextIsPartOfKey) {
+  auto cache = YogaMeasurementCache{};
+  auto layoutContext = LayoutContext{};
+  auto key = YogaMeasurementCache::makeKey(
+      100,
+      YGMeasureModeAtMost,
+      YGUndefined,
+      YGMeasureModeUndefined,
+      YGDirectionLTR,
+      layoutContext);
+  cache.set(key, Size{.width = 80, .height = 20});
+
+  layoutContext.fontSizeMultiplier = 2;
+  auto scaledKey = YogaMeasurementCache::makeKey(
+      100,
+      YGMeasureModeAtMost,
+      YGUndefined,
+      YGMeasureModeUndefined,
+      YGDirectionLTR,
+      layoutContext);
+
+  EXPECT_FALSE(cache.get(scaledKey).has_value());
+}
+
+TEST(YogaMeasurementCacheTest, oldestEntryIsEvicted) {
+  auto cache = YogaMeasurementCache{};
+  for (size_t i = 0; i <= YogaMeasurementCache::MaxEntries; i++) {
+    cache.set(
+        makeKey(static_cast<float>(i), YGMeasureModeAtMost),
+        Size{.width = static_cast<Float>(i), .height = 20});
+  }
+
+  EXPECT_FALSE(cache.get(makeKey(0, YGMeasureModeAtMost)).has_value());
+  for (size_t i = 1; i <= YogaMeasurementCache::MaxEntries; i++) {
+    auto size = cache.get(makeKey(static_cast<float>(i), YGMeasureModeAtMost));
+    ASSERT_TRUE(size.has_value());
+    EXPECT_EQ(size->width, static_cast<Float>(i));
+  }
+}
+
+TEST(YogaMeasurementCacheTest, countsHitsAndMisses) {
+  auto cache = YogaMeasurementCache{};
+  auto key = makeKey(100, YGMeasureModeAtMost);
+  auto statistics = YogaMeasurementCache::getStatistics();
+
+  cache.get(key);
+  cache.set(key, Size{.width = 80, .height = 20});
+  cache.get(key);
+  cache.get(key);
+
+  auto newStatistics = YogaMeasurementCache::getStatistics();
+  EXPECT_EQ(
+      newStatistics.measurementCacheMissCount -
+          statistics.measurementCacheMissCount,
+      1);
+  EXPECT_EQ(
+      newStatistics.measurementCacheHitCount -
+          statistics.measurementCacheHitCount,
+      2);
+}
+
+} // namespace facebook::react
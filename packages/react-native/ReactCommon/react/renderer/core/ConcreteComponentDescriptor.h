@@ -114,6 +114,21 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
 
     rawProps.parse(rawPropsParser_);
 
+#ifndef RN_SERIALIZABLE_STATE
+    // Optimization:
+    // Updates usually change a few props, like `opacity` during animations.
+    // When `setProp` can apply all of them, they are applied on a copy of the
+    // base `props` object instead of parsing every prop again. This is not done
+    // with serializable state, since the copy would not update `rawProps`.
+    if constexpr (RawPropsIncrementallySettable<ShadowNodeT>) {
+      if (props) {
+        if (auto shadowNodeProps = setPropsIncrementally(context, *props, rawProps)) {
+          return shadowNodeProps;
+        }
+      }
+    }
+#endif
+
     auto shadowNodeProps = ShadowNodeT::Props(context, rawProps, props);
     // Use the new-style iterator
     // Note that we just check if `Props` has this flag set, no matter
@@ -172,6 +187,37 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     // Default implementation does nothing.
     react_native_assert(shadowNode.getComponentHandle() == getComponentHandle());
   }
+
+ private:
+  /*
+   * Returns a copy of `sourceProps` with the props of `rawProps` applied with
+   * `setProp`, or `nullptr` if some of them cannot be applied that way.
+   */
+  std::shared_ptr<ConcreteProps>
+  setPropsIncrementally(const PropsParserContext &context, const Props &sourceProps, const RawProps &rawProps) const
+  {
+    auto canSetProps = true;
+    rawPropsParser_.iterateOverValues(
+        rawProps, [&](RawPropsPropNameHash hash, const char * /*name*/, const RawValue & /*value*/) {
+          canSetProps = canSetProps && ShadowNodeT::canSetPropIncrementally(hash);
+        });
+    if (!canSetProps) {
+      return nullptr;
+    }
+
+    auto shadowNodeProps = std::make_shared<ConcreteProps>(static_cast<const ConcreteProps &>(sourceProps));
+    try {
+      rawPropsParser_.iterateOverValues(
+          rawProps, [&](RawPropsPropNameHash hash, const char *name, const RawValue &value) {
+            shadowNodeProps->setProp(context, hash, name, value);
+          });
+    } catch (const std::exception &) {
+      // Parsing falls back to default values for values that fail to convert,
+      // and logs errors.
+      return nullptr;
+    }
+    return shadowNodeProps;
+  }
 };
 
 template <typename TManager>
@@ -13,41 +13,78 @@
 
 namespace facebook::react {
 
-EventQueue::EventQueue(
-    EventQueueProcessor eventProcessor,
-    std::unique_ptr<EventBeat> eventBeat)
-    : eventProcessor_(std::move(eventProcessor)),
-      eventBeat_(std::move(eventBeat)) {
-  eventBeat_->setBeatCallback(
-      [this](jsi::Runtime& runtime) { onBeat(runtime); });
-}
+namespace {
 
-void EventQueue::enqueueEvent(RawEvent&& rawEvent) const {
-  {
-    std::scoped_lock lock(queueMutex_);
+/*
+ * Coalesces unique events of the queue in place, preserving the order of the
+ * remaining events.
+ * A unique event replaces the last queued event for the same target if that
+ * event is unique and has the same type.
+ */
+void coalesceUniqueEvents(std::vector<RawEvent>& queue) {
+  // Events in `[0, size)` are the ones kept so far.
+  size_t size = 0;
+
+  for (size_t index = 0; index < queue.size(); index++) {
+    auto& rawEvent = queue[index];
 
     if (rawEvent.isUnique) {
-      auto repeatedEvent = eventQueue_.rend();
+      RawEvent* repeatedEvent = nullptr;
 
-      for (auto it = eventQueue_.rbegin(); it != eventQueue_.rend(); ++it) {
-        if (it->eventTarget == rawEvent.eventTarget) {
+      for (auto i = size; i > 0; i--) {
+        auto& event = queue[i - 1];
+        if (event.eventTarget == rawEvent.eventTarget) {
           // It is necessary to maintain order of different event types
           // for the same target. If the same target has event types A1, B1
           // in the event queue and event A2 occurs. A1 has to stay in the
           // queue.
-          if (it->isUnique && it->type == rawEvent.type) {
-            repeatedEvent = it;
+          if (event.isUnique && event.type == rawEvent.type) {
+            repeatedEvent = &event;
           }
 
           break;
         }
       }
 
-      if (repeatedEvent == eventQueue_.rend()) {
-        eventQueue_.push_back(std::move(rawEvent));
-      } else {
+      if (repeatedEvent != nullptr) {
         *repeatedEvent = std::move(rawEvent);
+        continue;
       }
+    }
+
+    if (index != size) {
+      queue[size] = std::move(rawEvent);
+    }
+    size++;
+  }
+
+  queue.erase(queue.begin() + static_cast<std::ptrdiff_t>(size), queue.end());
+}
+
+} // namespace
+
+EventQueue::EventQueue(
+    EventQueueProcessor eventProcessor,
+    std::unique_ptr<EventBeat> eventBeat)
+    : eventProcessor_(std::move(eventProcessor)),
+      eventBeat_(std::move(eventBeat)) {
+  eventBeat_->setBeatCallback(
+      [this](jsi::Runtime& runtime) { onBeat(runtime); });
+}
+
+void EventQueue::enqueueEvent(RawEvent&& rawEvent) const {
+  {
+    std::scoped_lock lock(eventQueueMutex_);
+
+    // Producers only look at the last queued event, which covers bursts of
+    // events for a single target (e.g. scrolling) without growing the queue.
+    // Everything else is coalesced when the queue is flushed, so the lock is
+    // held for constant time.
+    auto lastEvent = eventQueue_.empty() ? nullptr : &eventQueue_.back();
+    if (rawEvent.isUnique && lastEvent != nullptr && lastEvent->isUnique &&
+        lastEvent->eventTarget == rawEvent.eventTarget &&
+        lastEvent->type == rawEvent.type) {
+      *lastEvent = std::move(rawEvent);
     } else {
       eventQueue_.push_back(std::move(rawEvent));
     }
@@ -65,7 +102,7 @@ void EventQueue::enqueueStateUpdate(
     StateUpdate&& stateUpdate,
     UpdateMode updateMode) const {
   {
-    std::scoped_lock lock(queueMutex_);
+    std::scoped_lock lock(stateUpdateQueueMutex_);
     if (!stateUpdateQueue_.empty()) {
       const auto position = stateUpdateQueue_.back();
       if (stateUpdate.family == position.family) {
@@ -99,16 +136,17 @@ void EventQueue::flushEvents(jsi::Runtime& runtime) const {
   std::vector<RawEvent> queue;
 
   {
-    std::scoped_lock lock(queueMutex_);
+    std::scoped_lock lock(eventQueueMutex_);
 
     if (eventQueue_.empty()) {
       return;
     }
 
-    queue = std::move(eventQueue_);
-    eventQueue_.clear();
+    queue.swap(eventQueue_);
   }
 
+  coalesceUniqueEvents(queue);
+
   eventProcessor_.flushEvents(runtime, std::move(queue));
 }
 
@@ -116,7 +154,7 @@ void EventQueue::flushStateUpdates() const {
   std::vector<StateUpdate> stateUpdateQueue;
 
   {
-    std::scoped_lock lock(queueMutex_);
+    std::scoped_lock lock(stateUpdateQueueMutex_);
 
     if (stateUpdateQueue_.empty()) {
       return;
@@ -78,10 +78,14 @@ class EventQueue {
   EventQueueProcessor eventProcessor_;
 
   const std::unique_ptr<EventBeat> eventBeat_;
-  // Thread-safe, protected by `queueMutex_`.
+  // Thread-safe, protected by `eventQueueMutex_`.
+  // Producers only append to the queue (or replace its last event); unique
+  // events are coalesced by the consumer after swapping the queue out.
   mutable std::vector<RawEvent> eventQueue_;
+  mutable std::mutex eventQueueMutex_;
+  // Thread-safe, protected by `stateUpdateQueueMutex_`.
   mutable std::vector<StateUpdate> stateUpdateQueue_;
-  mutable std::mutex queueMutex_;
+  mutable std::mutex stateUpdateQueueMutex_;
 };
 
 } // namespace facebook::react
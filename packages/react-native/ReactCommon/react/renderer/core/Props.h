@@ -41,7 +41,6 @@ class Props : public virtual Sealable, public virtual DebugStringConvertible {
   virtual ~Props() = default;
 #endif
 
-  Props(const Props &other) = delete;
   Props &operator=(const Props &other) = delete;
 
   /**
@@ -82,6 +81,12 @@ class Props : public virtual Sealable, public virtual DebugStringConvertible {
 #endif
 
  protected:
+  /*
+   * Copying is reserved to the incremental cloning of props (see
+   * `RawPropsIncrementallySettable`), which applies changed props on a copy.
+   */
+  Props(const Props &other) = default;
+
   /** Initialize member variables of Props instance */
   void initialize(
       const PropsParserContext &context,
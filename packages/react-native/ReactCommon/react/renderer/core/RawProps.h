@@ -137,4 +137,16 @@ concept RawPropsFilterable = requires(RawProps &rawProps) {
   { T::filterRawProps(rawProps) } -> std::same_as<void>;
 };
 
+/*
+ * Props of shadow nodes satisfying this concept are cloned by applying only the
+ * props present in `RawProps` on top of a copy of the source props with
+ * `setProp`, instead of parsing every prop, when `canSetPropIncrementally`
+ * returns `true` for all of them. It must only return `true` for props for which
+ * `setProp` gives the same result as the parsing constructor.
+ */
+template <typename T>
+concept RawPropsIncrementallySettable = requires(RawPropsPropNameHash hash) {
+  { T::canSetPropIncrementally(hash) } -> std::same_as<bool>;
+};
+
 } // namespace facebook::react
@@ -13,6 +13,7 @@
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
+#include <react/utils/hash_combine.h>
 
 namespace facebook::react {
 
@@ -70,3 +71,14 @@ bool operator!=(const RawPropsKey& lhs, const RawPropsKey& rhs) noexcept {
 }
 
 } // namespace facebook::react
+
+size_t std::hash<facebook::react::RawPropsKey>::operator()(
+    const facebook::react::RawPropsKey& key) const noexcept {
+  // Hashes the strings rather than the pointers, same as `operator==`
+  // compares them.
+  auto fragment = [](const char* string) {
+    return string != nullptr ? std::string_view{string} : std::string_view{};
+  };
+  return facebook::react::hash_combine(
+      fragment(key.prefix), fragment(key.name), fragment(key.suffix));
+}
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include <react/renderer/core/RawPropsPrimitives.h>
@@ -38,3 +39,10 @@ bool operator==(const RawPropsKey &lhs, const RawPropsKey &rhs) noexcept;
 bool operator!=(const RawPropsKey &lhs, const RawPropsKey &rhs) noexcept;
 
 } // namespace facebook::react
+
+namespace std {
+template <>
+struct hash<facebook::react::RawPropsKey> {
+  size_t operator()(const facebook::react::RawPropsKey &key) const noexcept;
+};
+} // namespace std
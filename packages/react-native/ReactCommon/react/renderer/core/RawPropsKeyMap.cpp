@@ -32,6 +32,19 @@ bool RawPropsKeyMap::shouldFirstOneBeBeforeSecondOne(
   return std::memcmp(lhs.name, rhs.name, rhs.length) < 0;
 }
 
+uint64_t RawPropsKeyMap::hashName(
+    uint64_t seed,
+    const char* name,
+    RawPropsPropNameLength length) noexcept {
+  // 64-bit FNV-1a, starting from a seeded offset basis.
+  auto hash = 14695981039346656037ull ^ seed;
+  for (RawPropsPropNameLength i = 0; i < length; i++) {
+    hash ^= static_cast<uint8_t>(name[i]);
+    hash *= 1099511628211ull;
+  }
+  return RawPropsPerfectHash::mix(hash);
+}
+
 void RawPropsKeyMap::insert(
     const RawPropsKey& key,
     RawPropsValueIndex value) noexcept {
@@ -73,21 +86,16 @@ void RawPropsKeyMap::reindex() noexcept {
     items_.erase(++result, items_.end());
   }
 
-  buckets_.resize(kPropNameLengthHardCap);
-
-  auto length = RawPropsPropNameLength{0};
-  for (size_t i = 0; i < items_.size(); i++) {
-    auto& item = items_[i];
-    if (item.length != length) {
-      for (auto j = length; j < item.length; j++) {
-        buckets_[j] = static_cast<RawPropsPropNameLength>(i);
-      }
-      length = item.length;
+  // Names are distinct now, so building only fails if two of their hashes
+  // collide, which another seed fixes.
+  auto hashes = std::vector<uint64_t>(items_.size());
+  for (seed_ = 0;; seed_++) {
+    for (size_t i = 0; i < items_.size(); i++) {
+      hashes[i] = hashName(seed_, items_[i].name, items_[i].length);
+    }
+    if (perfectHash_.build(hashes)) {
+      break;
     }
-  }
-
-  for (size_t j = length; j < buckets_.size(); j++) {
-    buckets_[j] = static_cast<RawPropsPropNameLength>(items_.size());
   }
 }
 
@@ -96,25 +104,16 @@ RawPropsValueIndex RawPropsKeyMap::at(
     RawPropsPropNameLength length) noexcept {
   react_native_assert(length > 0);
   react_native_assert(length < kPropNameLengthHardCap);
-  // 1. Find the bucket.
-  auto lower = int{buckets_[length - 1]};
-  auto upper = int{buckets_[length]} - 1;
-  react_native_assert(lower - 1 <= upper);
-
-  // 2. Binary search in the bucket.
-  while (lower <= upper) {
-    auto median = (lower + upper) / 2;
-    auto condition = std::memcmp(items_[median].name, name, length);
-    if (condition < 0) {
-      lower = median + 1;
-    } else if (condition == 0) {
-      return items_[median].value;
-    } else /* if (condition > 0) */ {
-      upper = median - 1;
-    }
+  auto index = perfectHash_.find(hashName(seed_, name, length));
+  if (index == kRawPropsValueIndexEmpty) {
+    return kRawPropsValueIndexEmpty;
   }
 
-  return kRawPropsValueIndexEmpty;
+  const auto& item = items_[index];
+  if (item.length != length || std::memcmp(item.name, name, length) != 0) {
+    return kRawPropsValueIndexEmpty;
+  }
+  return item.value;
 }
 
 } // namespace facebook::react
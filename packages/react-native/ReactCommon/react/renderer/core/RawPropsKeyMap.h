@@ -8,6 +8,7 @@
 #pragma once
 
 #include <react/renderer/core/RawPropsKey.h>
+#include <react/renderer/core/RawPropsPerfectHash.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
 #include <vector>
 
@@ -15,8 +16,8 @@ namespace facebook::react {
 
 /*
  * A map especially optimized to hold `{name: index}` relations.
- * The implementation is conceptually similar to a classic hash map with a hash
- * function that returns the length of the string.
+ * Reindexing builds a perfect hash over the names, so that a lookup hashes the
+ * name and compares it with a single stored name.
  * The map is optimized for reads only (the map must be reindexed before a bunch
  * of reads).
  */
@@ -48,9 +49,11 @@ class RawPropsKeyMap final {
 
   static bool shouldFirstOneBeBeforeSecondOne(const Item &lhs, const Item &rhs) noexcept;
   static bool hasSameName(const Item &lhs, const Item &rhs) noexcept;
+  static uint64_t hashName(uint64_t seed, const char *name, RawPropsPropNameLength length) noexcept;
 
   std::vector<Item> items_{};
-  std::vector<RawPropsPropNameLength> buckets_{};
+  RawPropsPerfectHash perfectHash_{};
+  uint64_t seed_{0};
 };
 
 } // namespace facebook::react
@@ -8,12 +8,33 @@
 #include "RawPropsParser.h"
 
 #include <react/debug/react_native_assert.h>
+#include <react/renderer/core/PropsMacros.h>
 #include <react/renderer/core/RawProps.h>
 
 #include <glog/logging.h>
+#include <algorithm>
+#include <array>
 
 namespace facebook::react {
 
+namespace {
+
+bool hasSameFragments(const RawPropsKey& lhs, const RawPropsKey& rhs) {
+  return lhs.name == rhs.name && lhs.prefix == rhs.prefix &&
+      lhs.suffix == rhs.suffix;
+}
+
+uint64_t hashFragments(uint64_t seed, const RawPropsKey& key) {
+  auto hash = RawPropsPerfectHash::mix(
+      seed ^ reinterpret_cast<uintptr_t>(key.prefix));
+  hash = RawPropsPerfectHash::mix(
+      hash ^ reinterpret_cast<uintptr_t>(key.name));
+  return RawPropsPerfectHash::mix(
+      hash ^ reinterpret_cast<uintptr_t>(key.suffix));
+}
+
+} // namespace
+
 // During parser initialization, Props structs are used to parse
 // "fake"/empty objects, and `at` is called repeatedly which tells us
 // which props are accessed during parsing, and in which order.
@@ -27,61 +48,44 @@ const RawValue* RawPropsParser::at(
     // access fields a second (or third, etc) time.
     // Without this, multiple entries will be created for the same key, but
     // only the first access of the key will return a sensible value.
-    // The complexity of this is (n + (n - 1) + (n - 2) + ... + (n - (n - 1) +
-    // 1))) or n*n - (1/2)(n*(n+1)). If there are 100 props, this will result in
-    // 4950 lookups and equality checks on initialization of the parser, which
-    // happens exactly once per component.
-    size_t size = keys_.size();
-    for (size_t i = 0; i < size; i++) {
-      if (keys_[i] == key) {
-        return nullptr;
-      }
+    if (!preparedKeys_.insert(key).second) {
+      return nullptr;
     }
     // This is not thread-safe part; this happens only during initialization of
     // a `ComponentDescriptor` where it is actually safe.
+    size_t size = keys_.size();
     keys_.push_back(key);
     react_native_assert(size < std::numeric_limits<RawPropsValueIndex>::max());
     nameToIndex_.insert(key, static_cast<RawPropsValueIndex>(size));
     return nullptr;
   }
 
-// Normally, keys are looked up in-order. For performance we can simply
-// increment this key counter, and if the key is equal to the key at the next
-// index, there's no need to do any lookups. However, it's possible for keys
-// to be accessed out-of-order or multiple times, in which case we start
-// searching again from index 0.
-// To prevent infinite loops (which can occur if you look up a key that
-// doesn't exist) we keep track of whether or not we've already looped around,
-// and log and return nullptr if so. However, we ONLY do this in debug mode,
-// where you're more likely to look up a nonexistent key as part of debugging.
-// You can (and must) ensure infinite loops are not possible in production by:
-// (1) constructing all props objects without conditionals, or (2) if there
-// are conditionals, ensure that in the parsing setup case, the Props
-// constructor will access _all_ possible props. To ensure this performance
-// optimization is utilized, always access props in the same order every time.
-// This is trivial if you have a simple Props constructor, but difficult or
-// impossible if you have a shared sub-prop Struct that is used by multiple
-// parent Props.
-#ifdef REACT_NATIVE_DEBUG
-  bool resetLoop = false;
-#endif
-  do {
-    rawProps.keyIndexCursor_++;
-
-    if (static_cast<size_t>(rawProps.keyIndexCursor_) >= keys_.size())
-        [[unlikely]] {
+  // Normally, keys are looked up in-order, so the key after the previously
+  // looked up one is checked first. Other keys are found with a perfect hash
+  // of their fragment pointers, which are the same as while preparing when
+  // keys come from the same `convertRawProp` call. Keys with the same strings
+  // at other addresses are found by comparing strings.
+  auto keyIndex = static_cast<size_t>(rawProps.keyIndexCursor_ + 1);
+  if (keyIndex >= keys_.size()) {
+    keyIndex = 0;
+  }
+  if (keyIndex >= keys_.size() || !hasSameFragments(keys_[keyIndex], key)) {
+    keyIndex = keyIndices_.find(hashFragments(keyIndicesSeed_, key));
+    if (keyIndex == kRawPropsValueIndexEmpty ||
+        !hasSameFragments(keys_[keyIndex], key)) [[unlikely]] {
+      auto it = std::find(keys_.begin(), keys_.end(), key);
+      if (it == keys_.end()) {
 #ifdef REACT_NATIVE_DEBUG
-      if (resetLoop) {
         LOG(ERROR)
             << "Looked up property name which was not seen when preparing: "
             << (std::string)key;
+#endif
         return nullptr;
       }
-      resetLoop = true;
-#endif
-      rawProps.keyIndexCursor_ = 0;
+      keyIndex = static_cast<size_t>(std::distance(keys_.begin(), it));
     }
-  } while (key != keys_[rawProps.keyIndexCursor_]);
+  }
+  rawProps.keyIndexCursor_ = static_cast<int>(keyIndex);
 
   auto valueIndex = rawProps.keyIndexToValueIndex_[rawProps.keyIndexCursor_];
   return valueIndex == kRawPropsValueIndexEmpty ? nullptr
@@ -90,7 +94,28 @@ const RawValue* RawPropsParser::at(
 
 void RawPropsParser::postPrepare() noexcept {
   ready_ = true;
+  preparedKeys_ = {};
   nameToIndex_.reindex();
+
+  // Keys are distinct, so building only fails if two of their hashes collide,
+  // which another seed fixes.
+  auto hashes = std::vector<uint64_t>(keys_.size());
+  for (keyIndicesSeed_ = 0;; keyIndicesSeed_++) {
+    for (size_t i = 0; i < keys_.size(); i++) {
+      hashes[i] = hashFragments(keyIndicesSeed_, keys_[i]);
+    }
+    if (keyIndices_.build(hashes)) {
+      break;
+    }
+  }
+
+  auto name = std::array<char, kPropNameLengthHardCap>();
+  keyHashes_.resize(keys_.size());
+  for (size_t i = 0; i < keys_.size(); i++) {
+    RawPropsPropNameLength length = 0;
+    keys_[i].render(name.data(), &length);
+    keyHashes_[i] = RAW_PROPS_KEY_HASH(std::string_view(name.data(), length));
+  }
 }
 
 void RawPropsParser::preparse(const RawProps& rawProps) const noexcept {
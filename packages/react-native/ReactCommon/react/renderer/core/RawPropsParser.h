@@ -13,9 +13,13 @@
 #include <react/renderer/core/RawProps.h>
 #include <react/renderer/core/RawPropsKey.h>
 #include <react/renderer/core/RawPropsKeyMap.h>
+#include <react/renderer/core/RawPropsPerfectHash.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
 #include <react/renderer/core/RawValue.h>
 
+#include <array>
+#include <unordered_set>
+
 namespace facebook::react {
 
 /*
@@ -76,8 +80,36 @@ class RawPropsParser final {
    */
   const RawValue *at(const RawProps &rawProps, const RawPropsKey &key) const noexcept;
 
+  /*
+   * Calls `visit` with the name hash, the name and the value of every prop of
+   * `rawProps` that was seen when preparing, in the order of `keys_`.
+   * To be used by `ConcreteComponentDescriptor` only.
+   */
+  template <typename VisitorT>
+  void iterateOverValues(const RawProps &rawProps, VisitorT &&visit) const
+  {
+    auto name = std::array<char, kPropNameLengthHardCap>();
+    for (size_t keyIndex = 0; keyIndex < rawProps.keyIndexToValueIndex_.size(); keyIndex++) {
+      auto valueIndex = rawProps.keyIndexToValueIndex_[keyIndex];
+      if (valueIndex == kRawPropsValueIndexEmpty) {
+        continue;
+      }
+      RawPropsPropNameLength length = 0;
+      keys_[keyIndex].render(name.data(), &length);
+      name[length] = 0;
+      visit(keyHashes_[keyIndex], name.data(), rawProps.values_[valueIndex]);
+    }
+  }
+
   mutable std::vector<RawPropsKey> keys_{};
+  // Keys seen while preparing, only used until the parser is ready.
+  mutable std::unordered_set<RawPropsKey> preparedKeys_{};
   mutable RawPropsKeyMap nameToIndex_{};
+  // Perfect hash of the fragment pointers of `keys_`.
+  mutable RawPropsPerfectHash keyIndices_{};
+  mutable uint64_t keyIndicesSeed_{0};
+  // `RAW_PROPS_KEY_HASH` of the full names of `keys_`, as `setProp` expects.
+  mutable std::vector<RawPropsPropNameHash> keyHashes_{};
   mutable bool ready_{false};
 };
 
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RawPropsPerfectHash.h"
+
+#include <react/debug/react_native_assert.h>
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+
+namespace facebook::react {
+
+namespace {
+
+// Displacements tried for a bucket before giving up. Only reached if the
+// hashes are badly distributed.
+constexpr uint32_t kMaxDisplacement = 1 << 16;
+
+} // namespace
+
+bool RawPropsPerfectHash::build(const std::vector<uint64_t>& hashes) noexcept {
+  react_native_assert(hashes.size() < kRawPropsValueIndexEmpty);
+  displacements_.clear();
+  indices_.clear();
+  if (hashes.empty()) {
+    return true;
+  }
+
+  // Equal hashes would have to share a slot.
+  auto sortedHashes = hashes;
+  std::sort(sortedHashes.begin(), sortedHashes.end());
+  if (std::adjacent_find(sortedHashes.begin(), sortedHashes.end()) !=
+      sortedHashes.end()) {
+    return false;
+  }
+
+  // About two hashes per bucket and a load factor of at most 0.8 keep the
+  // search for displacements short.
+  auto bucketCount = std::bit_ceil(std::max<size_t>(hashes.size() / 2, 1));
+  auto slotCount = std::bit_ceil(hashes.size() + hashes.size() / 4 + 1);
+  bucketMask_ = bucketCount - 1;
+  slotMask_ = slotCount - 1;
+
+  auto buckets = std::vector<std::vector<RawPropsValueIndex>>(bucketCount);
+  for (size_t i = 0; i < hashes.size(); i++) {
+    buckets[(hashes[i] >> 32) & bucketMask_].push_back(
+        static_cast<RawPropsValueIndex>(i));
+  }
+
+  // Placing the largest buckets first, while most slots are still free.
+  auto bucketOrder = std::vector<size_t>(bucketCount);
+  std::iota(bucketOrder.begin(), bucketOrder.end(), 0);
+  std::stable_sort(
+      bucketOrder.begin(), bucketOrder.end(), [&](size_t lhs, size_t rhs) {
+        return buckets[lhs].size() > buckets[rhs].size();
+      });
+
+  displacements_.assign(bucketCount, 0);
+  indices_.assign(slotCount, kRawPropsValueIndexEmpty);
+  auto bucketSlots = std::vector<size_t>{};
+  for (auto bucket : bucketOrder) {
+    const auto& bucketIndices = buckets[bucket];
+    if (bucketIndices.empty()) {
+      break;
+    }
+
+    auto placed = false;
+    for (uint32_t displacement = 0;
+         displacement < kMaxDisplacement && !placed;
+         displacement++) {
+      bucketSlots.clear();
+      placed = true;
+      for (auto index : bucketIndices) {
+        auto candidate = slot(hashes[index], displacement);
+        if (indices_[candidate] != kRawPropsValueIndexEmpty ||
+            std::find(bucketSlots.begin(), bucketSlots.end(), candidate) !=
+                bucketSlots.end()) {
+          placed = false;
+          break;
+        }
+        bucketSlots.push_back(candidate);
+      }
+
+      if (placed) {
+        displacements_[bucket] = displacement;
+        for (size_t i = 0; i < bucketIndices.size(); i++) {
+          indices_[bucketSlots[i]] = bucketIndices[i];
+        }
+      }
+    }
+
+    if (!placed) {
+      displacements_.clear();
+      indices_.clear();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace facebook::react
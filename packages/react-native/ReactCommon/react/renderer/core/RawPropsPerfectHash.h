@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/RawPropsPrimitives.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A perfect hash table over a fixed set of 64-bit hashes, built once with the
+ * "hash and displace" algorithm.
+ * `find` maps every hash of the set to its index in the set with a single
+ * probe. Other hashes map to some index or to `kRawPropsValueIndexEmpty`, so
+ * the caller must check the candidate it gets.
+ */
+class RawPropsPerfectHash final {
+ public:
+  /*
+   * Builds the table. Fails if some hashes are equal, in which case the set
+   * must be hashed again with another seed.
+   */
+  bool build(const std::vector<uint64_t> &hashes) noexcept;
+
+  RawPropsValueIndex find(uint64_t hash) const noexcept
+  {
+    if (indices_.empty()) {
+      return kRawPropsValueIndexEmpty;
+    }
+    auto displacement = displacements_[(hash >> 32) & bucketMask_];
+    return indices_[slot(hash, displacement)];
+  }
+
+  /*
+   * Scrambles the bits of `value` (the finalizer of SplitMix64).
+   */
+  static uint64_t mix(uint64_t value) noexcept
+  {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+    return value ^ (value >> 31);
+  }
+
+ private:
+  size_t slot(uint64_t hash, uint32_t displacement) const noexcept
+  {
+    return static_cast<size_t>(mix(hash + displacement * 0x9e3779b97f4a7c15) & slotMask_);
+  }
+
+  std::vector<uint32_t> displacements_{};
+  std::vector<RawPropsValueIndex> indices_{};
+  uint64_t bucketMask_{0};
+  uint64_t slotMask_{0};
+};
+
+} // namespace facebook::react
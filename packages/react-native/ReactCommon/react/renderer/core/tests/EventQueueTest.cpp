@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventQueue.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/InstanceHandle.h>
+#include <react/renderer/core/ValueFactoryEventPayload.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+class TestEventQueue : public EventQueue {
+ public:
+  using EventQueue::EventQueue;
+  using EventQueue::flushEvents;
+};
+
+struct DispatchedEvent {
+  const EventTarget* eventTarget;
+  std::string type;
+  const EventPayload* eventPayload;
+};
+
+} // namespace
+
+class EventQueueTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    runtimeScheduler_ = std::make_unique<RuntimeScheduler>(
+        [](std::function<void(jsi::Runtime&)>&& /*callback*/) {});
+
+    auto eventPipe = [this](
+                         jsi::Runtime& /*runtime*/,
+                         const EventTarget* eventTarget,
+                         const std::string& type,
+                         ReactEventPriority /*priority*/,
+                         const EventPayload& payload) {
+      dispatchedEvents_.push_back(
+          {.eventTarget = eventTarget, .type = type, .eventPayload = &payload});
+    };
+
+    auto eventProcessor = EventQueueProcessor(
+        eventPipe,
+        [](jsi::Runtime& /*runtime*/) {},
+        [](const StateUpdate& /*stateUpdate*/) {},
+        {});
+
+    ownerBox_ = std::make_shared<EventBeat::OwnerBox>();
+    eventQueue_ = std::make_unique<TestEventQueue>(
+        std::move(eventProcessor),
+        std::make_unique<EventBeat>(ownerBox_, *runtimeScheduler_));
+  }
+
+  SharedEventTarget createEventTarget(Tag tag) {
+    auto instanceHandle = std::make_shared<InstanceHandle>(
+        *runtime_, jsi::Value(*runtime_, jsi::Object(*runtime_)), tag);
+    auto eventTarget =
+        std::make_shared<EventTarget>(std::move(instanceHandle), 1);
+    eventTarget->setEnabled(true);
+    return eventTarget;
+  }
+
+  SharedEventPayload createEventPayload() {
+    return std::make_shared<ValueFactoryEventPayload>(
+        [](jsi::Runtime& /*runtime*/) { return jsi::Value::undefined(); });
+  }
+
+  RawEvent createEvent(
+      std::string type,
+      const SharedEventPayload& eventPayload,
+      const SharedEventTarget& eventTarget) {
+    return RawEvent(std::move(type), eventPayload, eventTarget, {});
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::unique_ptr<RuntimeScheduler> runtimeScheduler_;
+  std::shared_ptr<EventBeat::OwnerBox> ownerBox_;
+  std::unique_ptr<TestEventQueue> eventQueue_;
+  std::vector<DispatchedEvent> dispatchedEvents_;
+};
+
+TEST_F(EventQueueTest, repeatedUniqueEventsAreCoalesced) {
+  auto eventTarget = createEventTarget(1);
+  auto firstPayload = createEventPayload();
+  auto lastPayload = createEventPayload();
+
+  eventQueue_->enqueueUniqueEvent(
+      createEvent("scroll", firstPayload, eventTarget));
+  eventQueue_->enqueueUniqueEvent(
+      createEvent("scroll", createEventPayload(), eventTarget));
+  eventQueue_->enqueueUniqueEvent(
+      createEvent("scroll", lastPayload, eventTarget));
+  eventQueue_->flushEvents(*runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 1);
+  EXPECT_EQ(dispatchedEvents_[0].type, "scroll");
+  EXPECT_EQ(dispatchedEvents_[0].eventPayload, lastPayload.get());
+}
+
+TEST_F(EventQueueTest, interleavedEventTypesAreNotCoalesced) {
+  auto eventTarget = createEventTarget(1);
+
+  eventQueue_->enqueueUniqueEvent(
+      createEvent("scroll", createEventPayload(), eventTarget));
+  eventQueue_->enqueueEvent(
+      createEvent("touch", createEventPayload(), eventTarget));
+  eventQueue_->enqueueUniqueEvent(
+      createEvent("scroll", createEventPayload(), eventTarget));
+  eventQueue_->flushEvents(*runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 3);
+  EXPECT_EQ(dispatchedEvents_[0].type, "scroll");
+  EXPECT_EQ(dispatchedEvents_[1].type, "touch");
+  EXPECT_EQ(dispatchedEvents_[2].type, "scroll");
+}
+
+TEST_F(EventQueueTest, uniqueEventsKeepTheirPosition) {
+  auto firstEventTarget = createEventTarget(1);
+  auto secondEventTarget = createEventTarget(2);
+  auto lastPayload = createEventPayload();
+
+  eventQueue_->enqueueUniqueEvent(
+      createEvent("scroll", createEventPayload(), firstEventTarget));
+  eventQueue_->enqueueUniqueEvent(
+      createEvent("scroll", createEventPayload(), secondEventTarget));
+  eventQueue_->enqueueUniqueEvent(
+      createEvent("scroll", lastPayload, firstEventTarget));
+  eventQueue_->flushEvents(*runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 2);
+  EXPECT_EQ(dispatchedEvents_[0].eventTarget, firstEventTarget.get());
+  EXPECT_EQ(dispatchedEvents_[0].eventPayload, lastPayload.get());
+  EXPECT_EQ(dispatchedEvents_[1].eventTarget, secondEventTarget.get());
+}
+
+TEST_F(EventQueueTest, eventsFromConcurrentProducersAreAllDispatched) {
+  constexpr auto kProducerCount = 4;
+  constexpr auto kEventCount = 1000;
+
+  auto eventTargets = std::vector<SharedEventTarget>{};
+  for (int i = 0; i < kProducerCount; i++) {
+    eventTargets.push_back(createEventTarget(i + 1));
+  }
+
+  auto producers = std::vector<std::thread>{};
+  for (int i = 0; i < kProducerCount; i++) {
+    producers.emplace_back([&, i]() {
+      for (int j = 0; j < kEventCount; j++) {
+        eventQueue_->enqueueEvent(
+            createEvent("touch", createEventPayload(), eventTargets[i]));
+      }
+    });
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  eventQueue_->flushEvents(*runtime_);
+
+  EXPECT_EQ(dispatchedEvents_.size(), kProducerCount * kEventCount);
+}
+
+} // namespace facebook::react
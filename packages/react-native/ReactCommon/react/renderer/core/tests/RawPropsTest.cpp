@@ -375,6 +375,25 @@ TEST(RawPropsTest, handlePropsMultiLookup) {
   EXPECT_NEAR(props->derivedFloatValue, 20.0, 0.00001);
 }
 
+TEST(RawPropsTest, handleRawPropsLookupWithNameAtOtherAddress) {
+  auto raw = RawProps(folly::dynamic::object("intValue", (int)42)(
+      "doubleValue", (double)17.42));
+
+  auto parser = RawPropsParser();
+  parser.prepare<PropsPrimitiveTypes>();
+  raw.parse(parser);
+
+  // Names that are not the literals used while preparing are still found.
+  auto doubleValueName = std::string{"doubleValue"};
+  auto intValueName = std::string{"intValue"};
+  EXPECT_NEAR(
+      (double)*raw.at(doubleValueName.c_str(), nullptr, nullptr),
+      17.42,
+      0.0000001);
+  EXPECT_EQ((int)*raw.at(intValueName.c_str(), nullptr, nullptr), 42);
+  EXPECT_EQ((int)*raw.at("intValue", nullptr, nullptr), 42);
+}
+
 TEST(RawPropsTest, copyDynamicRawProps) {
   ContextContainer contextContainer{};
   PropsParserContext parserContext{-1, contextContainer};
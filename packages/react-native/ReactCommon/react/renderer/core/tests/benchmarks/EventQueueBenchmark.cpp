@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventQueue.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/InstanceHandle.h>
+#include <react/renderer/core/ValueFactoryEventPayload.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+// The consumer flushes the queue once per this many of its own iterations,
+// approximating a JS thread that drains events on every frame while the
+// producers keep enqueueing.
+constexpr auto kFlushInterval = 64;
+constexpr auto kMaximumThreadCount = 8;
+
+class BenchmarkEventQueue : public EventQueue {
+ public:
+  using EventQueue::EventQueue;
+  using EventQueue::flushEvents;
+};
+
+struct EventQueueFixture {
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime;
+  std::unique_ptr<RuntimeScheduler> runtimeScheduler;
+  std::shared_ptr<EventBeat::OwnerBox> ownerBox;
+  std::unique_ptr<BenchmarkEventQueue> eventQueue;
+  std::vector<SharedEventTarget> eventTargets;
+  std::vector<SharedEventPayload> eventPayloads;
+
+  EventQueueFixture() {
+    runtime = facebook::hermes::makeHermesRuntime();
+    runtimeScheduler = std::make_unique<RuntimeScheduler>(
+        [](std::function<void(jsi::Runtime&)>&& /*callback*/) {});
+
+    auto eventProcessor = EventQueueProcessor(
+        [](jsi::Runtime& /*runtime*/,
+           const EventTarget* /*eventTarget*/,
+           const std::string& /*type*/,
+           ReactEventPriority /*priority*/,
+           const EventPayload& /*payload*/) {},
+        [](jsi::Runtime& /*runtime*/) {},
+        [](const StateUpdate& /*stateUpdate*/) {},
+        {});
+
+    ownerBox = std::make_shared<EventBeat::OwnerBox>();
+    eventQueue = std::make_unique<BenchmarkEventQueue>(
+        std::move(eventProcessor),
+        std::make_unique<EventBeat>(ownerBox, *runtimeScheduler));
+
+    // Every producer thread gets its own target and payload, so the benchmark
+    // measures the queue rather than reference counting of shared objects.
+    for (int i = 0; i < kMaximumThreadCount; i++) {
+      auto instanceHandle = std::make_shared<InstanceHandle>(
+          *runtime, jsi::Value(*runtime, jsi::Object(*runtime)), i + 1);
+      auto eventTarget =
+          std::make_shared<EventTarget>(std::move(instanceHandle), 1);
+      eventTarget->setEnabled(true);
+      eventTargets.push_back(std::move(eventTarget));
+      eventPayloads.push_back(std::make_shared<ValueFactoryEventPayload>(
+          [](jsi::Runtime& /*runtime*/) { return jsi::Value::undefined(); }));
+    }
+  }
+};
+
+std::unique_ptr<EventQueueFixture> fixture;
+
+template <bool isUnique>
+void enqueueEventsWithContention(benchmark::State& state) {
+  auto threadIndex = static_cast<size_t>(state.thread_index());
+  if (threadIndex == 0) {
+    fixture = std::make_unique<EventQueueFixture>();
+  }
+
+  auto iteration = 0;
+  for (auto _ : state) {
+    auto& eventQueue = *fixture->eventQueue;
+    auto rawEvent = RawEvent(
+        isUnique ? "topScroll" : "topTouchMove",
+        fixture->eventPayloads[threadIndex],
+        fixture->eventTargets[threadIndex],
+        {},
+        RawEvent::Category::Continuous);
+
+    if (isUnique) {
+      eventQueue.enqueueUniqueEvent(std::move(rawEvent));
+    } else {
+      eventQueue.enqueueEvent(std::move(rawEvent));
+    }
+
+    // The first thread doubles as the consumer (the JS thread).
+    if (threadIndex == 0 && ++iteration % kFlushInterval == 0) {
+      eventQueue.flushEvents(*fixture->runtime);
+    }
+  }
+
+  if (threadIndex == 0) {
+    fixture->eventQueue->flushEvents(*fixture->runtime);
+    fixture.reset();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+static void enqueueEvent(benchmark::State& state) {
+  enqueueEventsWithContention<false>(state);
+}
+BENCHMARK(enqueueEvent)->ThreadRange(1, kMaximumThreadCount)->UseRealTime();
+
+static void enqueueUniqueEvent(benchmark::State& state) {
+  enqueueEventsWithContention<true>(state);
+}
+BENCHMARK(enqueueUniqueEvent)
+    ->ThreadRange(1, kMaximumThreadCount)
+    ->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
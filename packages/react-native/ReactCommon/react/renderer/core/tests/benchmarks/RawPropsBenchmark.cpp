@@ -8,9 +8,11 @@
 #include <benchmark/benchmark.h>
 #include <folly/dynamic.h>
 #include <folly/json.h>
+#include <react/renderer/components/text/TextComponentDescriptor.h>
 #include <react/renderer/components/view/ViewComponentDescriptor.h>
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/RawProps.h>
+#include <react/renderer/core/RawPropsParser.h>
 #include <react/utils/ContextContainer.h>
 #include <exception>
 #include <string>
@@ -33,6 +35,23 @@ auto propsStringWithSomeUnsupportedProps = std::string{
 auto unsupportedPropsDynamic =
     folly::parseJson(propsStringWithSomeUnsupportedProps);
 
+auto manyPropsString = std::string{
+    R"({"flex": 1, "flexDirection": "row", "alignItems": "center", "justifyContent": "space-between", "marginTop": 4, "marginBottom": 4, "paddingHorizontal": 12, "paddingVertical": 8, "width": "100%", "minHeight": 44, "backgroundColor": 4294967295, "borderRadius": 8, "borderWidth": 1, "borderColor": 4278190080, "opacity": 0.9, "shadowOpacity": 0.2, "shadowRadius": 4, "overflow": "hidden", "zIndex": 1, "pointerEvents": "box-none", "testID": "row", "nativeID": "some-id", "accessible": true, "accessibilityLabel": "Row", "collapsable": false})"};
+auto manyPropsDynamic = folly::parseJson(manyPropsString);
+auto opacityPropsDynamic = folly::parseJson(R"({"opacity": 0.5})");
+auto transformPropsDynamic = folly::parseJson(
+    R"({"transform": [{"translateX": 10}, {"scale": 1.5}], "opacity": 0.5})");
+auto widthPropsDynamic = folly::parseJson(R"({"width": 10})");
+
+auto textComponentDescriptor =
+    TextComponentDescriptor{ComponentDescriptorParameters{
+        .eventDispatcher = eventDispatcher,
+        .contextContainer = contextContainer}};
+auto textPropsString = std::string{
+    R"({"color": 4278190080, "fontFamily": "System", "fontSize": 14, "fontWeight": "600", "fontStyle": "italic", "letterSpacing": 0.5, "lineHeight": 20, "textAlign": "center", "textDecorationLine": "underline", "textTransform": "uppercase", "allowFontScaling": true, "backgroundColor": 4294967295, "opacity": 0.9})"};
+auto textPropsDynamic = folly::parseJson(textPropsString);
+auto sharedSourceTextProps = TextShadowNode::defaultSharedProps();
+
 auto sourceProps = ViewProps{};
 auto sharedSourceProps = ViewShadowNode::defaultSharedProps();
 
@@ -84,6 +103,70 @@ static void propParsingRegularRawPropsWithNoSourceProps(
 }
 BENCHMARK(propParsingRegularRawPropsWithNoSourceProps);
 
+static void propParsingManyRawProps(benchmark::State& state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, sharedSourceProps, RawProps{manyPropsDynamic});
+  }
+}
+BENCHMARK(propParsingManyRawProps);
+
+static void propCloning(
+    benchmark::State& state,
+    const folly::dynamic& updatedPropsDynamic) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto sourceProps = viewComponentDescriptor.cloneProps(
+      parserContext, nullptr, RawProps{manyPropsDynamic});
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, sourceProps, RawProps{updatedPropsDynamic});
+  }
+}
+BENCHMARK_CAPTURE(propCloning, opacity, opacityPropsDynamic);
+BENCHMARK_CAPTURE(propCloning, transformAndOpacity, transformPropsDynamic);
+BENCHMARK_CAPTURE(propCloning, width, widthPropsDynamic);
+
+static void textPropParsingEmptyRawProps(benchmark::State& state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    textComponentDescriptor.cloneProps(
+        parserContext, sharedSourceTextProps, RawProps{emptyPropsDynamic});
+  }
+}
+BENCHMARK(textPropParsingEmptyRawProps);
+
+static void textPropParsingRegularRawProps(benchmark::State& state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    textComponentDescriptor.cloneProps(
+        parserContext, sharedSourceTextProps, RawProps{textPropsDynamic});
+  }
+}
+BENCHMARK(textPropParsingRegularRawProps);
+
+static void parserPreparationForViewProps(benchmark::State& state) {
+  for (auto _ : state) {
+    auto parser = RawPropsParser{};
+    parser.prepare<ViewProps>();
+    benchmark::DoNotOptimize(parser);
+  }
+}
+BENCHMARK(parserPreparationForViewProps);
+
+static void parserPreparationForTextProps(benchmark::State& state) {
+  for (auto _ : state) {
+    auto parser = RawPropsParser{};
+    parser.prepare<TextProps>();
+    benchmark::DoNotOptimize(parser);
+  }
+}
+BENCHMARK(parserPreparationForTextProps);
+
 } // namespace facebook::react
 
 BENCHMARK_MAIN();
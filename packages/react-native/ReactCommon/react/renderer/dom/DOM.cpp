@@ -26,14 +26,7 @@ std::shared_ptr<const ShadowNode> getShadowNodeInRevision(
     return currentRevision;
   }
 
-  auto ancestors = shadowNode.getFamily().getAncestors(*currentRevision);
-
-  if (ancestors.empty()) {
-    return nullptr;
-  }
-
-  auto pair = ancestors.rbegin();
-  return pair->first.get().getChildren().at(pair->second);
+  return currentRevision->getDescendantShadowNode(shadowNode.getFamily());
 }
 
 std::shared_ptr<const ShadowNode> getParentShadowNodeInRevision(
@@ -127,6 +120,16 @@ LayoutMetrics getLayoutMetricsFromRoot(
       shadowNode.getFamily(), *layoutableAncestorShadowNode, policy);
 }
 
+LayoutMetrics getLayoutMetricsFromRoot(
+    const RootShadowNode& currentRevision,
+    const ShadowNode& shadowNode,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) {
+  // Measurements relative to the root of a revision are memoized by the
+  // revision itself.
+  return currentRevision.getLayoutMetricsOfDescendant(
+      shadowNode.getFamily(), policy);
+}
+
 Rect getScrollableContentBounds(
     Rect contentBounds,
     LayoutMetrics layoutMetrics) {
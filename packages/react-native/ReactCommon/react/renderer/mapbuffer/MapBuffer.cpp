@@ -6,6 +6,7 @@
  */
 
 #include "MapBuffer.h"
+#include "MapBufferView.h"
 
 namespace facebook::react {
 
@@ -86,58 +87,20 @@ int32_t MapBuffer::getDynamicDataOffset() const {
 }
 
 std::string MapBuffer::getString(Key key) const {
-  // TODO T83483191:Add checks to verify that offsets are under the boundaries
-  // of the map buffer
-  int32_t dynamicDataOffset = getDynamicDataOffset();
-  int32_t offset = getInt(key);
-  int32_t stringLength = *reinterpret_cast<const int32_t*>(
-      bytes_.data() + dynamicDataOffset + offset);
-  const uint8_t* stringPtr =
-      bytes_.data() + dynamicDataOffset + offset + sizeof(int);
-
-  return {stringPtr, stringPtr + stringLength};
+  return std::string(MapBufferView(*this).getString(key));
 }
 
 MapBuffer MapBuffer::getMapBuffer(Key key) const {
-  // TODO T83483191: Add checks to verify that offsets are under the boundaries
-  // of the map buffer
-  int32_t dynamicDataOffset = getDynamicDataOffset();
-
-  int32_t offset = getInt(key);
-  int32_t mapBufferLength = *reinterpret_cast<const int32_t*>(
-      bytes_.data() + dynamicDataOffset + offset);
-
-  std::vector<uint8_t> value(mapBufferLength);
-
-  memcpy(
-      value.data(),
-      bytes_.data() + dynamicDataOffset + offset + sizeof(int32_t),
-      mapBufferLength);
-
-  return MapBuffer(std::move(value));
+  return MapBufferView(*this).getMapBuffer(key).toMapBuffer();
 }
 
 std::vector<MapBuffer> MapBuffer::getMapBufferList(MapBuffer::Key key) const {
-  std::vector<MapBuffer> mapBufferList;
+  auto views = MapBufferView(*this).getMapBufferList(key);
 
-  int32_t dynamicDataOffset = getDynamicDataOffset();
-  int32_t offset = getInt(key);
-  int32_t mapBufferListLength = *reinterpret_cast<const int32_t*>(
-      bytes_.data() + dynamicDataOffset + offset);
-  offset = offset + sizeof(uint32_t);
-
-  int32_t curLen = 0;
-  while (curLen < mapBufferListLength) {
-    int32_t mapBufferLength = *reinterpret_cast<const int32_t*>(
-        bytes_.data() + dynamicDataOffset + offset + curLen);
-    curLen = curLen + sizeof(uint32_t);
-    std::vector<uint8_t> value(mapBufferLength);
-    memcpy(
-        value.data(),
-        bytes_.data() + dynamicDataOffset + offset + curLen,
-        mapBufferLength);
-    mapBufferList.emplace_back(std::move(value));
-    curLen = curLen + mapBufferLength;
+  std::vector<MapBuffer> mapBufferList;
+  mapBufferList.reserve(views.size());
+  for (const auto& view : views) {
+    mapBufferList.push_back(view.toMapBuffer());
   }
   return mapBufferList;
 }
@@ -124,6 +124,8 @@ class MapBuffer {
 
   double getDouble(MapBuffer::Key key) const;
 
+  // Copies the string out of the buffer; use MapBufferView to read strings and
+  // nested maps without copying.
   std::string getString(MapBuffer::Key key) const;
 
   // TODO T83483191: review this declaration
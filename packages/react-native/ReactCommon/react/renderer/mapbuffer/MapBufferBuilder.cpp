@@ -15,6 +15,15 @@ constexpr uint32_t LONG_SIZE = sizeof(uint64_t);
 constexpr uint32_t DOUBLE_SIZE = sizeof(double);
 constexpr uint32_t MAX_BUCKET_VALUE_SIZE = sizeof(uint64_t);
 
+// Maximum number of idle builders kept by the pool of each thread; enough for
+// a few levels of nested maps built at the same time.
+constexpr size_t MAX_POOLED_BUILDERS = 8;
+
+// Builders which grew their dynamic data beyond this size aren't returned to
+// the pool, so a single huge map doesn't pin its memory for the lifetime of
+// the thread.
+constexpr size_t MAX_POOLED_DYNAMIC_DATA_SIZE = 64 * 1024;
+
 MapBuffer MapBufferBuilder::EMPTY() {
   return MapBufferBuilder(0).build();
 }
@@ -153,6 +162,11 @@ void MapBufferBuilder::putMapBufferList(
       INT_SIZE);
 }
 
+void MapBufferBuilder::reserve(uint32_t keys, uint32_t bytes) {
+  buckets_.reserve(keys);
+  dynamicData_.reserve(bytes);
+}
+
 static inline bool compareBuckets(
     const MapBuffer::Bucket& a,
     const MapBuffer::Bucket& b) {
@@ -184,4 +198,41 @@ MapBuffer MapBufferBuilder::build() {
   return MapBuffer(std::move(buffer));
 }
 
+void MapBufferBuilder::reset() {
+  buckets_.clear();
+  dynamicData_.clear();
+  header_.count = 0;
+  header_.bufferSize = 0;
+  lastKey_ = 0;
+  needsSort_ = false;
+}
+
+static std::vector<std::unique_ptr<MapBufferBuilder>>& getBuilderPool() {
+  thread_local std::vector<std::unique_ptr<MapBufferBuilder>> pool;
+  return pool;
+}
+
+PooledMapBufferBuilder::PooledMapBufferBuilder() {
+  auto& pool = getBuilderPool();
+  if (pool.empty()) {
+    builder_ = std::make_unique<MapBufferBuilder>();
+  } else {
+    builder_ = std::move(pool.back());
+    pool.pop_back();
+  }
+}
+
+PooledMapBufferBuilder::~PooledMapBufferBuilder() {
+  if (!builder_ ||
+      builder_->dynamicData_.capacity() > MAX_POOLED_DYNAMIC_DATA_SIZE) {
+    return;
+  }
+
+  auto& pool = getBuilderPool();
+  if (pool.size() < MAX_POOLED_BUILDERS) {
+    builder_->reset();
+    pool.push_back(std::move(builder_));
+  }
+}
+
 } // namespace facebook::react
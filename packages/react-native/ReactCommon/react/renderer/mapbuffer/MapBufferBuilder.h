@@ -8,6 +8,7 @@
 #pragma once
 
 #include <react/debug/react_native_assert.h>
+#include <memory>
 #include <vector>
 #include "MapBuffer.h"
 
@@ -39,8 +40,21 @@ class MapBufferBuilder {
 
   void putMapBufferList(MapBuffer::Key key, const std::vector<MapBuffer> &mapBufferList);
 
+  /*
+   * Reserves storage for `keys` entries and `bytes` bytes of dynamic data
+   * (strings and nested maps), so that building a map of a known shape
+   * doesn't reallocate.
+   */
+  void reserve(uint32_t keys, uint32_t bytes);
+
   MapBuffer build();
 
+  /*
+   * Clears all entries but keeps the allocated storage, so the builder can be
+   * reused for building another map.
+   */
+  void reset();
+
  private:
   MapBuffer::Header header_;
 
@@ -53,6 +67,40 @@ class MapBufferBuilder {
   bool needsSort_{false};
 
   void storeKeyValue(MapBuffer::Key key, MapBuffer::DataType type, const uint8_t *value, uint32_t valueSize);
+
+  friend class PooledMapBufferBuilder;
+};
+
+/**
+ * PooledMapBufferBuilder is a MapBufferBuilder borrowed from a thread-local
+ * pool and returned to it (reset, but with its storage) on destruction. Use it
+ * for maps which are built often (e.g. text attributes and state updates) to
+ * avoid growing the storage of a fresh builder for every map.
+ * Nested maps can be built with pooled builders at the same time; when the
+ * pool is empty a new builder is allocated.
+ */
+class PooledMapBufferBuilder {
+ public:
+  PooledMapBufferBuilder();
+  ~PooledMapBufferBuilder();
+
+  PooledMapBufferBuilder(const PooledMapBufferBuilder &other) = delete;
+  PooledMapBufferBuilder &operator=(const PooledMapBufferBuilder &other) = delete;
+  PooledMapBufferBuilder(PooledMapBufferBuilder &&other) noexcept = default;
+  PooledMapBufferBuilder &operator=(PooledMapBufferBuilder &&other) noexcept = delete;
+
+  MapBufferBuilder &operator*() const
+  {
+    return *builder_;
+  }
+
+  MapBufferBuilder *operator->() const
+  {
+    return builder_.get();
+  }
+
+ private:
+  std::unique_ptr<MapBufferBuilder> builder_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MapBufferView.h"
+
+#include <cstring>
+
+namespace facebook::react {
+
+static inline int32_t bucketOffset(int32_t index) {
+  return sizeof(MapBuffer::Header) + sizeof(MapBuffer::Bucket) * index;
+}
+
+static inline int32_t valueOffset(int32_t bucketIndex) {
+  return bucketOffset(bucketIndex) + offsetof(MapBuffer::Bucket, data);
+}
+
+/*
+ * Reads a value of given type at given offset. Externally owned memory has no
+ * alignment guarantees, so values are copied out instead of dereferenced.
+ */
+template <typename T>
+static inline T readValue(std::span<const uint8_t> bytes, size_t offset) {
+  react_native_assert(
+      offset + sizeof(T) <= bytes.size() && "Read out of MapBuffer bounds");
+  T value;
+  std::memcpy(&value, bytes.data() + offset, sizeof(T));
+  return value;
+}
+
+MapBufferView::MapBufferView(std::span<const uint8_t> bytes) : bytes_(bytes) {
+  if (bytes_.size() < sizeof(MapBuffer::Header)) {
+    LOG(ERROR) << "Error: MapBuffer is too small to contain a header, found: "
+               << bytes_.size();
+    abort();
+  }
+
+  auto header = readValue<MapBuffer::Header>(bytes_, 0);
+  count_ = header.count;
+
+  if (header.bufferSize != bytes_.size()) {
+    LOG(ERROR) << "Error: Data size does not match, expected "
+               << header.bufferSize << " found: " << bytes_.size();
+    abort();
+  }
+}
+
+MapBufferView::MapBufferView(const MapBuffer& mapBuffer)
+    : MapBufferView(
+          std::span<const uint8_t>(mapBuffer.data(), mapBuffer.size())) {}
+
+int32_t MapBufferView::getKeyBucket(Key key) const {
+  int32_t lo = 0;
+  int32_t hi = count_ - 1;
+  while (lo <= hi) {
+    int32_t mid = (lo + hi) >> 1;
+
+    auto midVal = readValue<Key>(bytes_, bucketOffset(mid));
+
+    if (midVal < key) {
+      lo = mid + 1;
+    } else if (midVal > key) {
+      hi = mid - 1;
+    } else {
+      return mid;
+    }
+  }
+
+  return -1;
+}
+
+bool MapBufferView::contains(Key key) const {
+  return getKeyBucket(key) != -1;
+}
+
+int32_t MapBufferView::getInt(Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+  return readValue<int32_t>(bytes_, valueOffset(bucketIndex));
+}
+
+int64_t MapBufferView::getLong(Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+  return readValue<int64_t>(bytes_, valueOffset(bucketIndex));
+}
+
+bool MapBufferView::getBool(Key key) const {
+  return getInt(key) != 0;
+}
+
+double MapBufferView::getDouble(Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+  return readValue<double>(bytes_, valueOffset(bucketIndex));
+}
+
+int32_t MapBufferView::getDynamicDataOffset() const {
+  // The start of dynamic data can be calculated as the offset of the next
+  // key in the map
+  return bucketOffset(count_);
+}
+
+std::string_view MapBufferView::getString(Key key) const {
+  auto offset = getDynamicDataOffset() + getInt(key);
+  auto stringLength = readValue<int32_t>(bytes_, offset);
+  auto string = bytes_.subspan(offset + sizeof(int32_t), stringLength);
+
+  return {reinterpret_cast<const char*>(string.data()), string.size()};
+}
+
+MapBufferView MapBufferView::getMapBuffer(Key key) const {
+  auto offset = getDynamicDataOffset() + getInt(key);
+  auto mapBufferLength = readValue<int32_t>(bytes_, offset);
+
+  return MapBufferView(
+      bytes_.subspan(offset + sizeof(int32_t), mapBufferLength));
+}
+
+std::vector<MapBufferView> MapBufferView::getMapBufferList(Key key) const {
+  std::vector<MapBufferView> mapBufferList;
+
+  auto offset = getDynamicDataOffset() + getInt(key);
+  auto mapBufferListLength = readValue<int32_t>(bytes_, offset);
+  offset = offset + sizeof(uint32_t);
+
+  int32_t curLen = 0;
+  while (curLen < mapBufferListLength) {
+    auto mapBufferLength = readValue<int32_t>(bytes_, offset + curLen);
+    curLen = curLen + sizeof(uint32_t);
+    mapBufferList.emplace_back(
+        bytes_.subspan(offset + curLen, mapBufferLength));
+    curLen = curLen + mapBufferLength;
+  }
+  return mapBufferList;
+}
+
+MapBuffer MapBufferView::toMapBuffer() const {
+  return MapBuffer(std::vector<uint8_t>(bytes_.begin(), bytes_.end()));
+}
+
+size_t MapBufferView::size() const {
+  return bytes_.size();
+}
+
+const uint8_t* MapBufferView::data() const {
+  return bytes_.data();
+}
+
+uint16_t MapBufferView::count() const {
+  return count_;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/mapbuffer/MapBuffer.h>
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react {
+
+/**
+ * Non-owning, read-only view of MapBuffer-encoded data.
+ *
+ * The view reads directly from memory it doesn't own (e.g. the storage of a
+ * `MapBuffer`, a memory-mapped file or a buffer received from another VM), and
+ * returns strings and nested maps as views into the same memory, so reading
+ * never copies or allocates. The caller must keep the underlying memory alive
+ * for as long as the view (or any view derived from it) is in use.
+ *
+ * Use `toMapBuffer()` to get an owning copy.
+ */
+class MapBufferView {
+ public:
+  using Key = MapBuffer::Key;
+
+  /*
+   * Creates a view of given bytes, which must contain a complete MapBuffer
+   * (including the header).
+   */
+  explicit MapBufferView(std::span<const uint8_t> bytes);
+
+  /*
+   * Creates a view of the storage of given MapBuffer.
+   */
+  explicit MapBufferView(const MapBuffer &mapBuffer);
+
+  int32_t getInt(Key key) const;
+
+  int64_t getLong(Key key) const;
+
+  bool getBool(Key key) const;
+
+  double getDouble(Key key) const;
+
+  /*
+   * Returns a view of the string stored under given key; it points into the
+   * underlying memory.
+   */
+  std::string_view getString(Key key) const;
+
+  MapBufferView getMapBuffer(Key key) const;
+
+  std::vector<MapBufferView> getMapBufferList(Key key) const;
+
+  /*
+   * Returns true if the map contains a value for given key.
+   */
+  bool contains(Key key) const;
+
+  /*
+   * Copies the viewed bytes into a new, owning MapBuffer.
+   */
+  MapBuffer toMapBuffer() const;
+
+  size_t size() const;
+
+  const uint8_t *data() const;
+
+  uint16_t count() const;
+
+ private:
+  std::span<const uint8_t> bytes_;
+
+  // amount of items in the MapBuffer
+  uint16_t count_ = 0;
+
+  int32_t getKeyBucket(Key key) const;
+
+  // returns the offset where dynamic data starts
+  int32_t getDynamicDataOffset() const;
+};
+
+} // namespace facebook::react
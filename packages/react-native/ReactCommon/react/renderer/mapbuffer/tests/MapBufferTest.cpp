@@ -5,6 +5,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -12,6 +13,7 @@
 #include <gtest/gtest.h>
 #include <react/renderer/mapbuffer/MapBuffer.h>
 #include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mapbuffer/MapBufferView.h>
 
 using namespace facebook::react;
 
@@ -219,3 +221,157 @@ TEST(MapBufferTest, testMapRandomAccess) {
   EXPECT_EQ(map.getInt(1234), 4321);
   EXPECT_EQ(map.getString(65535), "Let's count: 的, 一, 是");
 }
+
+TEST(MapBufferTest, testViewPrimitiveEntries) {
+  auto builder = MapBufferBuilder();
+  builder.putInt(0, 1234);
+  builder.putLong(1, 1125899906842623LL);
+  builder.putBool(2, true);
+  builder.putDouble(3, 908.1);
+  auto map = builder.build();
+
+  auto view = MapBufferView(map);
+
+  EXPECT_EQ(view.count(), 4);
+  EXPECT_EQ(view.size(), map.size());
+  EXPECT_EQ(view.data(), map.data());
+  EXPECT_EQ(view.getInt(0), 1234);
+  EXPECT_EQ(view.getLong(1), 1125899906842623LL);
+  EXPECT_EQ(view.getBool(2), true);
+  EXPECT_EQ(view.getDouble(3), 908.1);
+  EXPECT_TRUE(view.contains(3));
+  EXPECT_FALSE(view.contains(4));
+}
+
+TEST(MapBufferTest, testViewStringPointsIntoBuffer) {
+  auto builder = MapBufferBuilder();
+  builder.putString(0, "This is a test");
+  builder.putString(1, "");
+  auto map = builder.build();
+
+  auto view = MapBufferView(map);
+  auto string = view.getString(0);
+
+  EXPECT_EQ(string, "This is a test");
+  EXPECT_GE(reinterpret_cast<const uint8_t*>(string.data()), map.data());
+  EXPECT_LE(
+      reinterpret_cast<const uint8_t*>(string.data() + string.size()),
+      map.data() + map.size());
+  EXPECT_EQ(view.getString(1), "");
+}
+
+TEST(MapBufferTest, testViewNestedEntries) {
+  auto builder = MapBufferBuilder();
+  builder.putString(0, "This is a test");
+  builder.putInt(1, 1234);
+  auto nestedMap = builder.build();
+
+  std::vector<MapBuffer> mapBufferList;
+  auto listBuilder = MapBufferBuilder();
+  listBuilder.putInt(2, 4321);
+  mapBufferList.push_back(listBuilder.build());
+  listBuilder = MapBufferBuilder();
+  listBuilder.putDouble(3, 908.1);
+  mapBufferList.push_back(listBuilder.build());
+
+  auto builder2 = MapBufferBuilder();
+  builder2.putMapBuffer(0, nestedMap);
+  builder2.putMapBufferList(1, mapBufferList);
+  auto map = builder2.build();
+
+  auto view = MapBufferView(map);
+
+  auto nestedView = view.getMapBuffer(0);
+  EXPECT_EQ(nestedView.count(), 2);
+  EXPECT_EQ(nestedView.getString(0), "This is a test");
+  EXPECT_EQ(nestedView.getInt(1), 1234);
+  EXPECT_GT(nestedView.data(), map.data());
+  EXPECT_LE(nestedView.data() + nestedView.size(), map.data() + map.size());
+
+  auto listViews = view.getMapBufferList(1);
+  EXPECT_EQ(listViews.size(), 2);
+  EXPECT_EQ(listViews[0].getInt(2), 4321);
+  EXPECT_EQ(listViews[1].getDouble(3), 908.1);
+
+  auto nestedCopy = nestedView.toMapBuffer();
+  EXPECT_NE(nestedCopy.data(), nestedView.data());
+  EXPECT_EQ(nestedCopy.getString(0), "This is a test");
+}
+
+TEST(MapBufferTest, testViewOfExternalMemory) {
+  auto builder = MapBufferBuilder();
+  builder.putInt(0, 1234);
+  builder.putString(1, "Let's count: 的, 一, 是");
+  auto map = builder.build();
+
+  // Place the bytes at an odd address to make sure unaligned values are read
+  // correctly.
+  auto storage = std::vector<uint8_t>(map.size() + 1);
+  std::copy(map.data(), map.data() + map.size(), storage.begin() + 1);
+
+  auto view = MapBufferView(std::span<const uint8_t>(
+      storage.data() + 1, storage.size() - 1));
+
+  EXPECT_EQ(view.count(), 2);
+  EXPECT_EQ(view.getInt(0), 1234);
+  EXPECT_EQ(view.getString(1), "Let's count: 的, 一, 是");
+}
+
+TEST(MapBufferTest, testUnorderedKeys) {
+  auto builder = MapBufferBuilder();
+  builder.putInt(3, 3);
+  builder.putString(1, "one");
+  builder.putInt(2, 2);
+  builder.putDouble(0, 0.5);
+  auto map = builder.build();
+
+  EXPECT_EQ(map.count(), 4);
+  EXPECT_EQ(map.getDouble(0), 0.5);
+  EXPECT_EQ(map.getString(1), "one");
+  EXPECT_EQ(map.getInt(2), 2);
+  EXPECT_EQ(map.getInt(3), 3);
+}
+
+TEST(MapBufferTest, testBuilderReset) {
+  auto builder = MapBufferBuilder();
+  builder.reserve(2, 32);
+  builder.putInt(1, 1234);
+  builder.putString(0, "This is a test");
+  auto map = builder.build();
+
+  builder.reset();
+  builder.putInt(0, 4321);
+  auto map2 = builder.build();
+
+  EXPECT_EQ(map.count(), 2);
+  EXPECT_EQ(map.getString(0), "This is a test");
+  EXPECT_EQ(map.getInt(1), 1234);
+  EXPECT_EQ(map2.count(), 1);
+  EXPECT_EQ(map2.getInt(0), 4321);
+}
+
+TEST(MapBufferTest, testPooledBuilder) {
+  const MapBufferBuilder* pooledBuilderAddress = nullptr;
+  {
+    auto builder = PooledMapBufferBuilder();
+    builder->putString(0, "This is a test");
+    builder->putInt(1, 1234);
+    auto map = builder->build();
+    EXPECT_EQ(map.count(), 2);
+    pooledBuilderAddress = &*builder;
+  }
+
+  auto outerBuilder = PooledMapBufferBuilder();
+  auto innerBuilder = PooledMapBufferBuilder();
+
+  // The builder returned to the pool is reused, starting out empty.
+  EXPECT_EQ(&*outerBuilder, pooledBuilderAddress);
+  EXPECT_NE(&*innerBuilder, &*outerBuilder);
+
+  innerBuilder->putInt(0, 4321);
+  outerBuilder->putMapBuffer(0, innerBuilder->build());
+  auto map = outerBuilder->build();
+
+  EXPECT_EQ(map.count(), 1);
+  EXPECT_EQ(map.getMapBuffer(0).getInt(0), 4321);
+}
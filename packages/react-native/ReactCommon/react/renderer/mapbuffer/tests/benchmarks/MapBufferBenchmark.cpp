@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/mapbuffer/MapBuffer.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+// Roughly the shape of the text attributes of a styled text fragment: a
+// dozen primitive values and a couple of short strings.
+constexpr uint32_t kKeyCount = 12;
+constexpr uint32_t kDynamicDataSize = 64;
+
+const std::string kFontFamily = "System";
+const std::string kFontWeight = "bold";
+
+void putValues(MapBufferBuilder& builder, bool ascending) {
+  for (uint32_t i = 0; i < kKeyCount; i++) {
+    auto key = static_cast<MapBuffer::Key>(ascending ? i : kKeyCount - i - 1);
+    switch (key % 4) {
+      case 0:
+        builder.putInt(key, static_cast<int32_t>(i));
+        break;
+      case 1:
+        builder.putDouble(key, i * 0.5);
+        break;
+      case 2:
+        builder.putBool(key, i % 2 == 0);
+        break;
+      default:
+        builder.putString(key, key % 8 == 3 ? kFontFamily : kFontWeight);
+        break;
+    }
+  }
+}
+
+} // namespace
+
+static void buildWithNewBuilder(benchmark::State& state) {
+  for (auto _ : state) {
+    auto builder = MapBufferBuilder();
+    putValues(builder, true);
+    benchmark::DoNotOptimize(builder.build());
+  }
+}
+BENCHMARK(buildWithNewBuilder);
+
+static void buildWithReservedBuilder(benchmark::State& state) {
+  for (auto _ : state) {
+    auto builder = MapBufferBuilder();
+    builder.reserve(kKeyCount, kDynamicDataSize);
+    putValues(builder, true);
+    benchmark::DoNotOptimize(builder.build());
+  }
+}
+BENCHMARK(buildWithReservedBuilder);
+
+static void buildWithPooledBuilder(benchmark::State& state) {
+  for (auto _ : state) {
+    auto builder = PooledMapBufferBuilder();
+    putValues(*builder, true);
+    benchmark::DoNotOptimize(builder->build());
+  }
+}
+BENCHMARK(buildWithPooledBuilder);
+
+static void buildWithPooledBuilderUnorderedKeys(benchmark::State& state) {
+  for (auto _ : state) {
+    auto builder = PooledMapBufferBuilder();
+    putValues(*builder, false);
+    benchmark::DoNotOptimize(builder->build());
+  }
+}
+BENCHMARK(buildWithPooledBuilderUnorderedKeys);
+
+static void buildNestedWithPooledBuilders(benchmark::State& state) {
+  for (auto _ : state) {
+    auto builder = PooledMapBufferBuilder();
+    for (uint32_t i = 0; i < 8; i++) {
+      auto nestedBuilder = PooledMapBufferBuilder();
+      putValues(*nestedBuilder, true);
+      builder->putMapBuffer(
+          static_cast<MapBuffer::Key>(i), nestedBuilder->build());
+    }
+    benchmark::DoNotOptimize(builder->build());
+  }
+}
+BENCHMARK(buildNestedWithPooledBuilders);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -11,7 +11,15 @@
 #include <react/debug/react_native_assert.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include "DifferentiatorWorkerPool.h"
 #include "internal/CullingContext.h"
+#include "internal/DiffArena.h"
 #include "internal/ShadowViewNodePair.h"
 #include "internal/TinyMap.h"
 #include "internal/sliceChildShadowNodeViewPairs.h"
@@ -29,6 +37,13 @@ namespace facebook::react {
 
 enum class ReparentMode { Flatten, Unflatten };
 
+/*
+ * In parallel mode, the maximum number of in-flight subtree diffs per worker
+ * thread. Enough to keep all workers busy while bounding the bookkeeping
+ * overhead for very wide trees.
+ */
+constexpr size_t kMaxPendingTasksPerWorkerThread = 4;
+
 #ifdef DEBUG_LOGS_DIFFER
 static std::ostream& operator<<(
     std::ostream& out,
@@ -43,9 +58,7 @@ static std::ostream& operator<<(
   return out;
 }
 
-static std::ostream& operator<<(
-    std::ostream& out,
-    std::vector<ShadowViewNodePair*> vec) {
+static std::ostream& operator<<(std::ostream& out, ShadowViewNodePairList vec) {
   for (int i = 0; i < vec.size(); i++) {
     if (i > 0) {
       out << ", ";
@@ -76,8 +89,7 @@ static std::ostream& operator<<(std::ostream& out, TinyMap<KeyT, ValueT>& map) {
  * possible. This can account for adding parent LayoutMetrics that are
  * important to take into account, but tricky, in (un)flattening cases.
  */
-static std::vector<ShadowViewNodePair*>
-sliceChildShadowNodeViewPairsFromViewNodePair(
+static ShadowViewNodePairList sliceChildShadowNodeViewPairsFromViewNodePair(
     const ShadowViewNodePair& shadowViewNodePair,
     ViewNodePairScope& scope,
     bool allowFlattened,
@@ -104,8 +116,8 @@ static_assert(
     std::is_move_constructible<ShadowViewNodePair>::value,
     "`ShadowViewNodePair` must be `move constructible`.");
 static_assert(
-    std::is_move_constructible<std::vector<ShadowViewNodePair*>>::value,
-    "`std::vector<ShadowViewNodePair*>` must be `move constructible`.");
+    std::is_move_constructible<ShadowViewNodePairList>::value,
+    "`ShadowViewNodePairList` must be `move constructible`.");
 
 static_assert(
     std::is_move_assignable<ShadowViewMutation>::value,
@@ -117,17 +129,177 @@ static_assert(
     std::is_move_assignable<ShadowViewNodePair>::value,
     "`ShadowViewNodePair` must be `move assignable`.");
 
+namespace {
+
+struct ParallelDiffingContext;
+
+} // namespace
+
 static void calculateShadowViewMutations(
     ViewNodePairScope& scope,
     ShadowViewMutation::List& mutations,
     Tag parentTag,
-    std::vector<ShadowViewNodePair*>&& oldChildPairs,
-    std::vector<ShadowViewNodePair*>&& newChildPairs,
+    ShadowViewNodePairList&& oldChildPairs,
+    ShadowViewNodePairList&& newChildPairs,
     const CullingContext& oldCullingContext = {},
-    const CullingContext& newCullingContext = {});
+    const CullingContext& newCullingContext = {},
+    ParallelDiffingContext* parallelDiffingContext = nullptr);
 
 namespace {
 
+/*
+ * State shared by all frames of a single parallel diff.
+ */
+struct ParallelDiffingContext {
+  DifferentiatorWorkerPool& workerPool;
+
+  /*
+   * The number of subtree diffs that were handed off and haven't finished
+   * yet. Past `maxPendingTaskCount`, subtrees are diffed inline.
+   */
+  std::atomic<size_t> pendingTaskCount{0};
+  const size_t maxPendingTaskCount;
+
+  bool tryReserveTask() {
+    auto count = pendingTaskCount.load(std::memory_order_relaxed);
+    while (count < maxPendingTaskCount) {
+      if (pendingTaskCount.compare_exchange_weak(
+              count, count + 1, std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void releaseTask() {
+    pendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+  }
+};
+
+/*
+ * Diffs the children of a single subtree, either on a worker thread or
+ * inline on whichever thread needs the result first.
+ * The task owns the `ViewNodePairScope` its child pair lists point into
+ * until the diff is done.
+ */
+class SubtreeDiffTask final {
+ public:
+  SubtreeDiffTask(
+      ParallelDiffingContext& context,
+      ViewNodePairScope&& scope,
+      Tag parentTag,
+      ShadowViewNodePairList&& oldChildPairs,
+      ShadowViewNodePairList&& newChildPairs,
+      const CullingContext& oldCullingContext,
+      const CullingContext& newCullingContext)
+      : context_(context),
+        input_(
+            Input{
+                .scope = std::move(scope),
+                .oldChildPairs = std::move(oldChildPairs),
+                .newChildPairs = std::move(newChildPairs)}),
+        parentTag_(parentTag),
+        oldCullingContext_(oldCullingContext),
+        newCullingContext_(newCullingContext) {}
+
+  /*
+   * Runs the diff unless it was already claimed by another thread.
+   */
+  void tryRun() {
+    if (!isClaimed_.exchange(true)) {
+      run();
+    }
+  }
+
+  /*
+   * Returns the resulting mutations, running the diff inline if no worker
+   * has picked it up yet, or waiting for the worker otherwise.
+   */
+  ShadowViewMutation::List& join() {
+    if (!isClaimed_.exchange(true)) {
+      run();
+    } else {
+      std::unique_lock lock(mutex_);
+      signal_.wait(lock, [this]() { return isDone_; });
+    }
+
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+
+    return mutations_;
+  }
+
+ private:
+  void run() {
+    try {
+      // The input was allocated from the arena of the scheduling thread,
+      // which must not be touched concurrently; everything this diff
+      // allocates comes from a task-local arena instead.
+      DiffArena arena{};
+      ViewNodePairScope scope{};
+
+      calculateShadowViewMutations(
+          scope,
+          mutations_,
+          parentTag_,
+          ShadowViewNodePairList(
+              input_->oldChildPairs.begin(), input_->oldChildPairs.end()),
+          ShadowViewNodePairList(
+              input_->newChildPairs.begin(), input_->newChildPairs.end()),
+          oldCullingContext_,
+          newCullingContext_,
+          &context_);
+    } catch (...) {
+      exception_ = std::current_exception();
+    }
+
+    // The input lives in the arena of the joining frame; it must be gone
+    // before that frame can return.
+    input_.reset();
+
+    // Must happen before signaling: the context does not outlive the join.
+    context_.releaseTask();
+
+    {
+      std::scoped_lock lock(mutex_);
+      isDone_ = true;
+    }
+
+    signal_.notify_all();
+  }
+
+  struct Input {
+    ViewNodePairScope scope;
+    ShadowViewNodePairList oldChildPairs;
+    ShadowViewNodePairList newChildPairs;
+  };
+
+  ParallelDiffingContext& context_;
+  std::optional<Input> input_;
+  Tag parentTag_;
+  CullingContext oldCullingContext_;
+  CullingContext newCullingContext_;
+
+  ShadowViewMutation::List mutations_{};
+  std::exception_ptr exception_{};
+
+  std::atomic<bool> isClaimed_{false};
+  std::mutex mutex_;
+  std::condition_variable signal_;
+  bool isDone_{false}; // Protected by `mutex_`.
+};
+
+/*
+ * Output of a `SubtreeDiffTask` which has to be spliced into `mutations` at
+ * `position` to preserve the order the serial algorithm would produce.
+ */
+struct PendingSubtreeMutations {
+  ShadowViewMutation::List* mutations;
+  size_t position;
+  std::shared_ptr<SubtreeDiffTask> task;
+};
+
 struct OrderedMutationInstructionContainer {
   ShadowViewMutation::List createMutations{};
   ShadowViewMutation::List deleteMutations{};
@@ -136,15 +308,117 @@ struct OrderedMutationInstructionContainer {
   ShadowViewMutation::List updateMutations{};
   ShadowViewMutation::List downwardMutations{};
   ShadowViewMutation::List destructiveDownwardMutations{};
+
+  ParallelDiffingContext* parallelDiffingContext{nullptr};
+  std::vector<PendingSubtreeMutations> pendingSubtreeMutations{};
 };
 
 } // namespace
 
+/**
+ * Diffs the children of a single (matched, created or deleted) node and
+ * appends the result to `mutations`, which must be either `downwardMutations`
+ * or `destructiveDownwardMutations` of `mutationContainer`.
+ *
+ * In parallel mode, the work may be handed off to the worker pool; the result
+ * is then spliced in place by `joinPendingSubtreeMutations`. Both lists are
+ * only ever appended to by this function, so the final order is the same as
+ * in the serial mode.
+ */
+static void calculateShadowViewMutationsForSubtree(
+    OrderedMutationInstructionContainer& mutationContainer,
+    ShadowViewMutation::List& mutations,
+    ViewNodePairScope&& scope,
+    Tag parentTag,
+    ShadowViewNodePairList&& oldChildPairs,
+    ShadowViewNodePairList&& newChildPairs,
+    const CullingContext& oldCullingContext,
+    const CullingContext& newCullingContext) {
+  auto parallelDiffingContext = mutationContainer.parallelDiffingContext;
+
+  if (parallelDiffingContext == nullptr ||
+      (oldChildPairs.empty() && newChildPairs.empty()) ||
+      !parallelDiffingContext->tryReserveTask()) {
+    calculateShadowViewMutations(
+        scope,
+        mutations,
+        parentTag,
+        std::move(oldChildPairs),
+        std::move(newChildPairs),
+        oldCullingContext,
+        newCullingContext,
+        parallelDiffingContext);
+    return;
+  }
+
+  auto task = std::make_shared<SubtreeDiffTask>(
+      *parallelDiffingContext,
+      std::move(scope),
+      parentTag,
+      std::move(oldChildPairs),
+      std::move(newChildPairs),
+      oldCullingContext,
+      newCullingContext);
+
+  mutationContainer.pendingSubtreeMutations.push_back(
+      {.mutations = &mutations, .position = mutations.size(), .task = task});
+
+  parallelDiffingContext->workerPool.schedule([task]() { task->tryRun(); });
+}
+
+/**
+ * Waits for all subtree diffs handed off from the current frame and splices
+ * their results into the downward mutation lists.
+ */
+static void joinPendingSubtreeMutations(
+    OrderedMutationInstructionContainer& mutationContainer) {
+  if (mutationContainer.pendingSubtreeMutations.empty()) {
+    return;
+  }
+
+  for (auto mutations :
+       {&mutationContainer.downwardMutations,
+        &mutationContainer.destructiveDownwardMutations}) {
+    auto mergedMutations = ShadowViewMutation::List{};
+    size_t position = 0;
+
+    for (auto& pending : mutationContainer.pendingSubtreeMutations) {
+      if (pending.mutations != mutations) {
+        continue;
+      }
+
+      auto& subtreeMutations = pending.task->join();
+
+      std::move(
+          mutations->begin() + static_cast<std::ptrdiff_t>(position),
+          mutations->begin() + static_cast<std::ptrdiff_t>(pending.position),
+          std::back_inserter(mergedMutations));
+      std::move(
+          subtreeMutations.begin(),
+          subtreeMutations.end(),
+          std::back_inserter(mergedMutations));
+      position = pending.position;
+    }
+
+    if (mergedMutations.empty()) {
+      continue;
+    }
+
+    std::move(
+        mutations->begin() + static_cast<std::ptrdiff_t>(position),
+        mutations->end(),
+        std::back_inserter(mergedMutations));
+    *mutations = std::move(mergedMutations);
+  }
+
+  mutationContainer.pendingSubtreeMutations.clear();
+}
+
 static void updateMatchedPairSubtrees(
     ViewNodePairScope& scope,
     OrderedMutationInstructionContainer& mutationContainer,
     TinyMap<Tag, ShadowViewNodePair*>& newRemainingPairs,
-    std::vector<ShadowViewNodePair*>& oldChildPairs,
+    ShadowViewNodePairList& oldChildPairs,
     Tag parentTag,
     const ShadowViewNodePair& oldPair,
     const ShadowViewNodePair& newPair,
@@ -184,7 +458,7 @@ static void updateMatchedPairSubtrees(
     ViewNodePairScope& scope,
     OrderedMutationInstructionContainer& mutationContainer,
     TinyMap<Tag, ShadowViewNodePair*>& newRemainingPairs,
-    std::vector<ShadowViewNodePair*>& oldChildPairs,
+    ShadowViewNodePairList& oldChildPairs,
     Tag parentTag,
     const ShadowViewNodePair& oldPair,
     const ShadowViewNodePair& newPair,
@@ -303,11 +577,12 @@ static void updateMatchedPairSubtrees(
         newPair, innerScope, false, newCullingContextCopy);
     const size_t newGrandChildPairsSize = newGrandChildPairs.size();
 
-    calculateShadowViewMutations(
-        innerScope,
+    calculateShadowViewMutationsForSubtree(
+        mutationContainer,
         *(newGrandChildPairsSize != 0u
               ? &mutationContainer.downwardMutations
               : &mutationContainer.destructiveDownwardMutations),
+        std::move(innerScope),
         oldPair.shadowView.tag,
         std::move(oldGrandChildPairs),
         std::move(newGrandChildPairs),
@@ -430,7 +705,7 @@ static void calculateShadowViewMutationsFlattener(
     const CullingContext& cullingContextForUnvisitedOtherNodes,
     const CullingContext& cullingContext) {
   // Step 1: iterate through entire tree
-  std::vector<ShadowViewNodePair*> treeChildren =
+  ShadowViewNodePairList treeChildren =
       sliceChildShadowNodeViewPairsFromViewNodePair(
           node, scope, false, cullingContext);
 
@@ -650,9 +925,10 @@ static void calculateShadowViewMutationsFlattener(
                   false,
                   adjustedNewCullingContext);
 
-          calculateShadowViewMutations(
-              innerScope,
+          calculateShadowViewMutationsForSubtree(
+              mutationContainer,
               mutationContainer.downwardMutations,
+              std::move(innerScope),
               newTreeNodePair.shadowView.tag,
               std::move(oldGrandChildPairs),
               std::move(newGrandChildPairs),
@@ -843,12 +1119,14 @@ static void calculateShadowViewMutationsFlattener(
 
       if (!treeChildPair.flattened) {
         ViewNodePairScope innerScope{};
-        calculateShadowViewMutations(
-            innerScope,
+        auto oldGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
+            treeChildPair, innerScope, false, adjustedCullingContext);
+        calculateShadowViewMutationsForSubtree(
+            mutationContainer,
             mutationContainer.destructiveDownwardMutations,
+            std::move(innerScope),
             treeChildPair.shadowView.tag,
-            sliceChildShadowNodeViewPairsFromViewNodePair(
-                treeChildPair, innerScope, false, adjustedCullingContext),
+            std::move(oldGrandChildPairs),
             {},
             adjustedCullingContext,
             {});
@@ -859,13 +1137,15 @@ static void calculateShadowViewMutationsFlattener(
 
       if (!treeChildPair.flattened) {
         ViewNodePairScope innerScope{};
-        calculateShadowViewMutations(
-            innerScope,
+        auto newGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
+            treeChildPair, innerScope, false, adjustedCullingContext);
+        calculateShadowViewMutationsForSubtree(
+            mutationContainer,
             mutationContainer.downwardMutations,
+            std::move(innerScope),
             treeChildPair.shadowView.tag,
             {},
-            sliceChildShadowNodeViewPairsFromViewNodePair(
-                treeChildPair, innerScope, false, adjustedCullingContext),
+            std::move(newGrandChildPairs),
             {},
             adjustedCullingContext);
       }
@@ -877,10 +1157,11 @@ static void calculateShadowViewMutations(
     ViewNodePairScope& scope,
     ShadowViewMutation::List& mutations,
     Tag parentTag,
-    std::vector<ShadowViewNodePair*>&& oldChildPairs,
-    std::vector<ShadowViewNodePair*>&& newChildPairs,
+    ShadowViewNodePairList&& oldChildPairs,
+    ShadowViewNodePairList&& newChildPairs,
     const CullingContext& oldCullingContext,
-    const CullingContext& newCullingContext) {
+    const CullingContext& newCullingContext,
+    ParallelDiffingContext* parallelDiffingContext) {
   if (oldChildPairs.empty() && newChildPairs.empty()) {
     return;
   }
@@ -888,7 +1169,8 @@ static void calculateShadowViewMutations(
   size_t index = 0;
 
   // Lists of mutations
-  auto mutationContainer = OrderedMutationInstructionContainer{};
+  auto mutationContainer = OrderedMutationInstructionContainer{
+      .parallelDiffingContext = parallelDiffingContext};
 
   DEBUG_LOGS({
     LOG(ERROR) << "Differ Entry: Child Pairs of node: [" << parentTag << "]";
@@ -951,11 +1233,12 @@ static void calculateShadowViewMutations(
 
       const size_t newGrandChildPairsSize = newGrandChildPairs.size();
 
-      calculateShadowViewMutations(
-          innerScope,
+      calculateShadowViewMutationsForSubtree(
+          mutationContainer,
           *(newGrandChildPairsSize != 0u
                 ? &mutationContainer.downwardMutations
                 : &mutationContainer.destructiveDownwardMutations),
+          std::move(innerScope),
           oldChildPair.shadowView.tag,
           std::move(oldGrandChildPairs),
           std::move(newGrandChildPairs),
@@ -994,12 +1277,14 @@ static void calculateShadowViewMutations(
       // We also have to call the algorithm recursively to clean up the entire
       // subtree starting from the removed view.
       ViewNodePairScope innerScope{};
-      calculateShadowViewMutations(
-          innerScope,
+      auto oldGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
+          oldChildPair, innerScope, false, oldCullingContextCopy);
+      calculateShadowViewMutationsForSubtree(
+          mutationContainer,
           mutationContainer.destructiveDownwardMutations,
+          std::move(innerScope),
           oldChildPair.shadowView.tag,
-          sliceChildShadowNodeViewPairsFromViewNodePair(
-              oldChildPair, innerScope, false, oldCullingContextCopy),
+          std::move(oldGrandChildPairs),
           {},
           oldCullingContextCopy,
           newCullingContext);
@@ -1030,13 +1315,15 @@ static void calculateShadowViewMutations(
           newCullingContext.adjustCullingContextIfNeeded(newChildPair);
 
       ViewNodePairScope innerScope{};
-      calculateShadowViewMutations(
-          innerScope,
+      auto newGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
+          newChildPair, innerScope, false, newCullingContextCopy);
+      calculateShadowViewMutationsForSubtree(
+          mutationContainer,
           mutationContainer.downwardMutations,
+          std::move(innerScope),
           newChildPair.shadowView.tag,
           {},
-          sliceChildShadowNodeViewPairsFromViewNodePair(
-              newChildPair, innerScope, false, newCullingContextCopy),
+          std::move(newGrandChildPairs),
           oldCullingContext,
           newCullingContextCopy);
     }
@@ -1271,9 +1558,10 @@ static void calculateShadowViewMutations(
 
         auto newGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
             oldChildPair, innerScope, false, oldCullingContextCopy);
-        calculateShadowViewMutations(
-            innerScope,
+        calculateShadowViewMutationsForSubtree(
+            mutationContainer,
             mutationContainer.destructiveDownwardMutations,
+            std::move(innerScope),
             oldChildPair.shadowView.tag,
             std::move(newGrandChildPairs),
             {},
@@ -1317,19 +1605,23 @@ static void calculateShadowViewMutations(
           newCullingContext.adjustCullingContextIfNeeded(newChildPair);
 
       ViewNodePairScope innerScope{};
+      auto newGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
+          newChildPair, innerScope, false, newCullingContextCopy);
 
-      calculateShadowViewMutations(
-          innerScope,
+      calculateShadowViewMutationsForSubtree(
+          mutationContainer,
           mutationContainer.downwardMutations,
+          std::move(innerScope),
           newChildPair.shadowView.tag,
           {},
-          sliceChildShadowNodeViewPairsFromViewNodePair(
-              newChildPair, innerScope, false, newCullingContextCopy),
+          std::move(newGrandChildPairs),
           oldCullingContext,
           newCullingContextCopy);
     }
   }
 
+  joinPendingSubtreeMutations(mutationContainer);
+
   // All mutations in an optimal order:
   std::move(
       mutationContainer.destructiveDownwardMutations.begin(),
@@ -1361,15 +1653,20 @@ static void calculateShadowViewMutations(
       std::back_inserter(mutations));
 }
 
-ShadowViewMutation::List calculateShadowViewMutations(
+static ShadowViewMutation::List calculateRootShadowViewMutations(
     const ShadowNode& oldRootShadowNode,
-    const ShadowNode& newRootShadowNode) {
+    const ShadowNode& newRootShadowNode,
+    ParallelDiffingContext* parallelDiffingContext) {
   TraceSection s("calculateShadowViewMutations");
 
   // Root shadow nodes must be belong the same family.
   react_native_assert(
       ShadowNode::sameFamily(oldRootShadowNode, newRootShadowNode));
 
+  // All temporaries of the diff are allocated from (and released with) this
+  // arena. It must be created before any of them.
+  DiffArena arena{};
+
   // See explanation of scope in Differentiator.h.
   ViewNodePairScope viewNodePairScope{};
   ViewNodePairScope innerViewNodePairScope{};
@@ -1403,7 +1700,10 @@ ShadowViewMutation::List calculateShadowViewMutations(
       mutations,
       oldRootShadowNode.getTag(),
       std::move(sliceOne),
-      std::move(sliceTwo));
+      std::move(sliceTwo),
+      {} /* oldCullingContext */,
+      {} /* newCullingContext */,
+      parallelDiffingContext);
 
   DEBUG_LOGS({
     LOG(ERROR) << "Differ Completed: " << mutations.size() << " mutations";
@@ -1440,4 +1740,24 @@ ShadowViewMutation::List calculateShadowViewMutations(
   return mutations;
 }
 
+ShadowViewMutation::List calculateShadowViewMutations(
+    const ShadowNode& oldRootShadowNode,
+    const ShadowNode& newRootShadowNode) {
+  return calculateRootShadowViewMutations(
+      oldRootShadowNode, newRootShadowNode, nullptr);
+}
+
+ShadowViewMutation::List calculateShadowViewMutations(
+    const ShadowNode& oldRootShadowNode,
+    const ShadowNode& newRootShadowNode,
+    DifferentiatorWorkerPool& workerPool) {
+  auto parallelDiffingContext = ParallelDiffingContext{
+      .workerPool = workerPool,
+      .maxPendingTaskCount =
+          workerPool.getNumberOfThreads() * kMaxPendingTasksPerWorkerThread};
+
+  return calculateRootShadowViewMutations(
+      oldRootShadowNode, newRootShadowNode, &parallelDiffingContext);
+}
+
 } // namespace facebook::react
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/mounting/DifferentiatorWorkerPool.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 
 namespace facebook::react {
@@ -21,4 +22,15 @@ ShadowViewMutation::List calculateShadowViewMutations(
     const ShadowNode &oldRootShadowNode,
     const ShadowNode &newRootShadowNode);
 
+/*
+ * Same as above, but diffs independent sibling subtrees concurrently on
+ * `workerPool`. The resulting list of mutations is identical to the one
+ * produced by the serial version.
+ * This mode is opt-in; it only pays off for large commits.
+ */
+ShadowViewMutation::List calculateShadowViewMutations(
+    const ShadowNode &oldRootShadowNode,
+    const ShadowNode &newRootShadowNode,
+    DifferentiatorWorkerPool &workerPool);
+
 } // namespace facebook::react
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "DifferentiatorWorkerPool.h"
+
+#include <react/debug/react_native_assert.h>
+
+namespace facebook::react {
+
+DifferentiatorWorkerPool::DifferentiatorWorkerPool(size_t numberOfThreads) {
+  react_native_assert(numberOfThreads > 0);
+
+  threads_.reserve(numberOfThreads);
+  for (size_t i = 0; i < numberOfThreads; i++) {
+    threads_.emplace_back([this]() { runLoop(); });
+  }
+}
+
+DifferentiatorWorkerPool::~DifferentiatorWorkerPool() {
+  {
+    std::scoped_lock lock(mutex_);
+    isStopping_ = true;
+  }
+
+  signal_.notify_all();
+
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+size_t DifferentiatorWorkerPool::getNumberOfThreads() const {
+  return threads_.size();
+}
+
+void DifferentiatorWorkerPool::schedule(Task&& task) {
+  {
+    std::scoped_lock lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+
+  signal_.notify_one();
+}
+
+void DifferentiatorWorkerPool::runLoop() {
+  while (true) {
+    auto task = Task{};
+
+    {
+      std::unique_lock lock(mutex_);
+      signal_.wait(lock, [this]() { return isStopping_ || !tasks_.empty(); });
+
+      // Remaining tasks are safe to drop: whoever scheduled them runs them
+      // inline when it needs the result.
+      if (isStopping_) {
+        return;
+      }
+
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+
+    task();
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A small fixed-size pool of worker threads used by
+ * `calculateShadowViewMutations` to diff independent sibling subtrees
+ * concurrently.
+ *
+ * The pool does not guarantee that a scheduled task will ever be picked up by
+ * a worker: the differ always claims and runs unclaimed tasks inline when it
+ * needs their results, so the pool only has to provide "best effort"
+ * parallelism. Because of that, a single pool can be safely shared between
+ * several surfaces diffing at the same time.
+ */
+class DifferentiatorWorkerPool final {
+ public:
+  using Task = std::function<void()>;
+
+  /*
+   * Spawns `numberOfThreads` worker threads. The threads are joined in the
+   * destructor.
+   */
+  explicit DifferentiatorWorkerPool(size_t numberOfThreads);
+  ~DifferentiatorWorkerPool();
+
+  /*
+   * Not copyable, not movable.
+   */
+  DifferentiatorWorkerPool(const DifferentiatorWorkerPool &other) = delete;
+  DifferentiatorWorkerPool &operator=(const DifferentiatorWorkerPool &other) = delete;
+
+  /*
+   * Returns the number of worker threads.
+   */
+  size_t getNumberOfThreads() const;
+
+  /*
+   * Enqueues `task` to be executed on one of the worker threads.
+   * Thread-safe.
+   */
+  void schedule(Task &&task);
+
+ private:
+  void runLoop();
+
+  std::vector<std::thread> threads_;
+
+  std::mutex mutex_;
+  std::condition_variable signal_;
+  std::deque<Task> tasks_; // Protected by `mutex_`.
+  bool isStopping_{false}; // Protected by `mutex_`.
+};
+
+} // namespace facebook::react
@@ -13,6 +13,7 @@
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/utils/LowPriorityExecutor.h>
 #include <condition_variable>
+#include <utility>
 #include "updateMountedFlag.h"
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
@@ -25,6 +26,7 @@ namespace facebook::react {
 MountingCoordinator::MountingCoordinator(const ShadowTreeRevision& baseRevision)
     : surfaceId_(baseRevision.rootShadowNode->getSurfaceId()),
       baseRevision_(baseRevision),
+      lastPushedRevisionNumber_(baseRevision.number),
       telemetryController_(*this) {
 #ifdef RN_SHADOW_TREE_INTROSPECTION
   stubViewTree_ = buildStubViewTreeWithoutUsingDifferentiator(
@@ -37,22 +39,36 @@ SurfaceId MountingCoordinator::getSurfaceId() const {
 }
 
 void MountingCoordinator::push(ShadowTreeRevision revision) const {
-  {
-    std::scoped_lock lock(mutex_);
+  // A replaced revision is destroyed after unlocking, as that may release a
+  // whole tree.
+  auto replacedRevision = std::optional<ShadowTreeRevision>{};
 
-    react_native_assert(
-        !lastRevision_.has_value() || revision.number != lastRevision_->number);
+  {
+    std::scoped_lock lock(lastRevisionMutex_);
 
-    if (!lastRevision_.has_value() || lastRevision_->number < revision.number) {
-      lastRevision_ = std::move(revision);
+    if (revision.number <= lastPushedRevisionNumber_) {
+      return;
     }
+
+    lastPushedRevisionNumber_ = revision.number;
+    replacedRevision = std::exchange(lastRevision_, std::move(revision));
   }
 
   signal_.notify_all();
 }
 
+std::optional<ShadowTreeRevision> MountingCoordinator::takeLastRevision()
+    const {
+  std::scoped_lock lock(lastRevisionMutex_);
+  if (lastRevision_.has_value()) {
+    // The transaction stays pending until `pullTransaction` is done with it.
+    hasPendingTransactionsOverride_ = true;
+  }
+  return std::exchange(lastRevision_, std::nullopt);
+}
+
 void MountingCoordinator::revoke() const {
-  std::scoped_lock lock(mutex_);
+  std::scoped_lock lock(mutex_, lastRevisionMutex_);
   // We have two goals here.
   // 1. We need to stop retaining `ShadowNode`s to not prolong their lifetime
   // to prevent them from overliving `ComponentDescriptor`s.
@@ -63,7 +79,7 @@ void MountingCoordinator::revoke() const {
 
 bool MountingCoordinator::waitForTransaction(
     std::chrono::duration<double> timeout) const {
-  std::unique_lock<std::mutex> lock(mutex_);
+  std::unique_lock<std::mutex> lock(lastRevisionMutex_);
   return signal_.wait_for(
       lock, timeout, [this]() { return lastRevision_.has_value(); });
 }
@@ -75,7 +91,7 @@ void MountingCoordinator::updateBaseRevision(
 }
 
 void MountingCoordinator::resetLatestRevision() const {
-  std::scoped_lock lock(mutex_);
+  std::scoped_lock lock(lastRevisionMutex_);
   lastRevision_.reset();
 }
 
@@ -85,18 +101,19 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
 
   std::scoped_lock lock(mutex_);
 
+  auto lastRevision = takeLastRevision();
   auto transaction = std::optional<MountingTransaction>{};
 
   // Base case
-  if (lastRevision_.has_value()) {
+  if (lastRevision.has_value()) {
     number_++;
 
-    auto telemetry = lastRevision_->telemetry;
+    auto telemetry = lastRevision->telemetry;
 
     telemetry.willDiff();
 
     auto mutations = calculateShadowViewMutations(
-        *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+        *baseRevision_.rootShadowNode, *lastRevision->rootShadowNode);
 
     telemetry.didDiff();
 
@@ -154,9 +171,9 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
     // If the transaction was overridden, we don't have a model of the shadow
     // tree therefore we cannot validate the validity of the mutation
     // instructions.
-    if (!didOverridePullTransaction && lastRevision_.has_value()) {
+    if (!didOverridePullTransaction && lastRevision.has_value()) {
       auto stubViewTree = buildStubViewTreeWithoutUsingDifferentiator(
-          *lastRevision_->rootShadowNode);
+          *lastRevision->rootShadowNode);
 
       bool treesEqual = stubViewTree_ == stubViewTree;
 
@@ -175,7 +192,7 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
         }
 
         std::stringstream ssNewTree(
-            lastRevision_->rootShadowNode->getDebugDescription());
+            lastRevision->rootShadowNode->getDebugDescription());
         while (std::getline(ssNewTree, line, '\n')) {
           LOG(ERROR) << "New tree:" << line;
         }
@@ -187,12 +204,11 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
   }
 #endif
 
-  if (lastRevision_.has_value()) {
+  if (lastRevision.has_value()) {
     if (ReactNativeFeatureFlags::enableDestroyShadowTreeRevisionAsync()) {
       LowPriorityExecutor::execute([toDelete = std::move(baseRevision_)]() {});
     }
-    baseRevision_ = std::move(*lastRevision_);
-    lastRevision_.reset();
+    baseRevision_ = std::move(*lastRevision);
 
     hasPendingTransactionsOverride_ = willPerformAsynchronously;
   }
@@ -200,12 +216,11 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
 }
 
 bool MountingCoordinator::hasPendingTransactions() const {
-  std::scoped_lock lock(mutex_);
+  std::scoped_lock lock(lastRevisionMutex_);
   return lastRevision_.has_value() || hasPendingTransactionsOverride_;
 }
 
 void MountingCoordinator::didPerformAsyncTransactions() const {
-  std::scoped_lock lock(mutex_);
   hasPendingTransactionsOverride_ = false;
 }
 
@@ -7,8 +7,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <mutex>
 #include <optional>
 
 #include <react/renderer/debug/flags.h>
@@ -114,6 +116,11 @@ class MountingCoordinator final {
 
   void push(ShadowTreeRevision revision) const;
 
+  /*
+   * Moves the last pushed revision (if any) out of the handoff slot.
+   */
+  std::optional<ShadowTreeRevision> takeLastRevision() const;
+
   /*
    * Revokes the last pushed `ShadowTreeRevision`.
    * Generating a `MountingTransaction` requires some resources which the
@@ -126,16 +133,24 @@ class MountingCoordinator final {
  private:
   const SurfaceId surfaceId_;
 
-  // Protects access to `baseRevision_`, `lastRevision_` and
-  // `mountingOverrideDelegate_`.
+  // Protects access to `baseRevision_`, `number_` and
+  // `mountingOverrideDelegates_`, and serializes `pullTransaction` calls.
   mutable std::mutex mutex_;
   mutable ShadowTreeRevision baseRevision_;
-  mutable bool hasPendingTransactionsOverride_{false};
-  mutable std::optional<ShadowTreeRevision> lastRevision_{};
+  mutable std::atomic<bool> hasPendingTransactionsOverride_{false};
   mutable MountingTransaction::Number number_{0};
-  mutable std::condition_variable signal_;
   mutable std::vector<std::weak_ptr<const MountingOverrideDelegate>> mountingOverrideDelegates_;
 
+  // Single-slot handoff of the most recent revision from `push` to
+  // `pullTransaction`. The mutex is only held to move a revision in or out of
+  // the slot, so a push never waits for a transaction being computed.
+  // `lastPushedRevisionNumber_` only grows, which keeps a revision pushed late
+  // by a slower commit from replacing a newer one.
+  mutable std::mutex lastRevisionMutex_;
+  mutable std::optional<ShadowTreeRevision> lastRevision_{};
+  mutable ShadowTreeRevision::Number lastPushedRevisionNumber_;
+  mutable std::condition_variable signal_;
+
   TelemetryController telemetryController_;
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
@@ -301,24 +301,30 @@ CommitStatus ShadowTree::tryCommit(
   }
 
   const auto& oldRootShadowNode = oldRevision.rootShadowNode;
+  telemetry.willRunTransaction();
   auto newRootShadowNode = transaction(*oldRevision.rootShadowNode);
+  telemetry.didRunTransaction();
 
   if (!newRootShadowNode) {
     return CommitStatus::Cancelled;
   }
 
   if (commitOptions.enableStateReconciliation) {
+    telemetry.willReconcileState();
     auto updatedNewRootShadowNode =
         progressState(*newRootShadowNode, *oldRootShadowNode);
     if (updatedNewRootShadowNode) {
       newRootShadowNode =
           std::static_pointer_cast<RootShadowNode>(updatedNewRootShadowNode);
     }
+    telemetry.didReconcileState();
   }
 
   // Run commit hooks.
+  telemetry.willRunCommitHooks();
   newRootShadowNode = delegate_.shadowTreeWillCommit(
       *this, oldRootShadowNode, newRootShadowNode, commitOptions);
+  telemetry.didRunCommitHooks();
 
   if (!newRootShadowNode) {
     return CommitStatus::Cancelled;
@@ -336,7 +342,9 @@ CommitStatus ShadowTree::tryCommit(
 
   {
     // Updating `currentRevision_` in unique manner if it hasn't changed.
+    telemetry.willAcquireCommitLock();
     UniqueLock lock = uniqueCommitLock();
+    telemetry.didAcquireCommitLock();
 
     if (currentRevision_.number != oldRevision.number) {
       return CommitStatus::Failed;
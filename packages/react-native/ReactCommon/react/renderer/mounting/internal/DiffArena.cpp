@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "DiffArena.h"
+
+#include <react/debug/react_native_assert.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace facebook::react {
+
+namespace {
+
+// The first block is small enough for trivial diffs; subsequent blocks double
+// in size up to the maximum.
+constexpr size_t kInitialBlockSize = 4 * 1024;
+constexpr size_t kMaximumBlockSize = 256 * 1024;
+
+thread_local DiffArena* currentArena = nullptr;
+
+std::atomic<size_t> allocationCount{0};
+std::atomic<size_t> heapAllocationCount{0};
+std::atomic<size_t> allocatedBytes{0};
+
+} // namespace
+
+DiffArena::DiffArena() noexcept
+    : previous_(currentArena), nextBlockSize_(kInitialBlockSize) {
+  currentArena = this;
+}
+
+DiffArena::~DiffArena() noexcept {
+  react_native_assert(currentArena == this);
+  currentArena = previous_;
+
+  allocationCount.fetch_add(
+      statistics_.allocationCount, std::memory_order_relaxed);
+  heapAllocationCount.fetch_add(
+      statistics_.heapAllocationCount, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(
+      statistics_.allocatedBytes, std::memory_order_relaxed);
+}
+
+DiffArena* DiffArena::current() noexcept {
+  return currentArena;
+}
+
+void* DiffArena::allocate(size_t size, size_t alignment) {
+  statistics_.allocationCount++;
+  statistics_.allocatedBytes += size;
+
+  auto address = reinterpret_cast<uintptr_t>(cursor_);
+  auto alignedAddress = (address + alignment - 1) & ~(alignment - 1);
+  auto padding = alignedAddress - address;
+
+  if (cursor_ == nullptr ||
+      padding + size > static_cast<size_t>(end_ - cursor_)) {
+    return allocateBlock(size);
+  }
+
+  auto pointer = cursor_ + padding;
+  cursor_ = pointer + size;
+  return pointer;
+}
+
+void* DiffArena::allocateBlock(size_t size) {
+  statistics_.heapAllocationCount++;
+
+  // Blocks returned by `new[]` are aligned for any fundamental type, which
+  // covers everything the differ allocates.
+  auto blockSize = std::max(nextBlockSize_, size);
+  nextBlockSize_ = std::min(nextBlockSize_ * 2, kMaximumBlockSize);
+
+  blocks_.push_back(std::make_unique<std::byte[]>(blockSize));
+  auto block = blocks_.back().get();
+
+  cursor_ = block + size;
+  end_ = block + blockSize;
+  return block;
+}
+
+DiffArenaStatistics DiffArena::getStatistics() noexcept {
+  return {
+      .allocationCount = allocationCount.load(std::memory_order_relaxed),
+      .heapAllocationCount =
+          heapAllocationCount.load(std::memory_order_relaxed),
+      .allocatedBytes = allocatedBytes.load(std::memory_order_relaxed)};
+}
+
+void DiffArena::resetStatistics() noexcept {
+  allocationCount.store(0, std::memory_order_relaxed);
+  heapAllocationCount.store(0, std::memory_order_relaxed);
+  allocatedBytes.store(0, std::memory_order_relaxed);
+}
+
+void DiffArena::recordHeapAllocation(size_t size) noexcept {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+} // namespace facebook::react
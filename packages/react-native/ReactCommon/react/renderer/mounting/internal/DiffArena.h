@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Allocation statistics of the differ temporaries, accumulated across all
+ * threads since the last `DiffArena::resetStatistics()` call.
+ * Arenas count their own allocations and publish them when destroyed, so
+ * allocations of live arenas are not included.
+ */
+struct DiffArenaStatistics {
+  /*
+   * Number of individual allocations requested by the differ's containers
+   * (what would have been heap allocations without an arena).
+   */
+  size_t allocationCount{0};
+
+  /*
+   * Number of allocations that actually hit the heap: arena blocks plus
+   * allocations made while no arena was active.
+   */
+  size_t heapAllocationCount{0};
+
+  /*
+   * Total number of bytes requested by the differ's containers.
+   */
+  size_t allocatedBytes{0};
+};
+
+/*
+ * A bump allocator backing all temporaries of a single diff
+ * (`ShadowViewNodePair`s, child pair lists and `TinyMap` storage).
+ * Individual deallocations are no-ops; all memory is released at once when
+ * the arena is destroyed.
+ *
+ * While alive, an arena is the *current* arena of the thread that created it,
+ * and `DiffArenaAllocator`s constructed on that thread allocate from it.
+ * Arenas nest (the previous one is restored on destruction) and must only be
+ * allocated from on the thread that created them.
+ */
+class DiffArena final {
+ public:
+  DiffArena() noexcept;
+  ~DiffArena() noexcept;
+
+  /*
+   * Not copyable, not movable.
+   */
+  DiffArena(const DiffArena &other) = delete;
+  DiffArena &operator=(const DiffArena &other) = delete;
+
+  /*
+   * Returns the current arena of the calling thread, or `nullptr`.
+   */
+  static DiffArena *current() noexcept;
+
+  void *allocate(size_t size, size_t alignment);
+
+  static DiffArenaStatistics getStatistics() noexcept;
+  static void resetStatistics() noexcept;
+
+  /*
+   * Accounts for an allocation made while no arena was active.
+   */
+  static void recordHeapAllocation(size_t size) noexcept;
+
+ private:
+  void *allocateBlock(size_t size);
+
+  DiffArena *previous_;
+  std::vector<std::unique_ptr<std::byte[]>> blocks_;
+  std::byte *cursor_{nullptr};
+  std::byte *end_{nullptr};
+  size_t nextBlockSize_;
+
+  // Published to the global statistics on destruction, so the allocation
+  // path does not touch memory shared with other threads.
+  DiffArenaStatistics statistics_{};
+};
+
+/*
+ * Standard allocator which allocates from the arena that was current on the
+ * thread where the allocator was created, or from the heap otherwise.
+ */
+template <typename T>
+class DiffArenaAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  DiffArenaAllocator() noexcept : arena_(DiffArena::current()) {}
+
+  template <typename U>
+  DiffArenaAllocator(const DiffArenaAllocator<U> &other) noexcept : arena_(other.arena_)
+  {
+  }
+
+  T *allocate(size_t n)
+  {
+    if (arena_ != nullptr) {
+      return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    DiffArena::recordHeapAllocation(n * sizeof(T));
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T *pointer, size_t n) noexcept
+  {
+    if (arena_ == nullptr) {
+      std::allocator<T>{}.deallocate(pointer, n);
+    }
+  }
+
+  template <typename U>
+  bool operator==(const DiffArenaAllocator<U> &rhs) const noexcept
+  {
+    return arena_ == rhs.arena_;
+  }
+
+  template <typename U>
+  bool operator!=(const DiffArenaAllocator<U> &rhs) const noexcept
+  {
+    return arena_ != rhs.arena_;
+  }
+
+ private:
+  template <typename U>
+  friend class DiffArenaAllocator;
+
+  DiffArena *arena_;
+};
+
+} // namespace facebook::react
@@ -8,7 +8,12 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <utility>
+#include <vector>
+
+#include "DiffArena.h"
 
 /*
  * Extremely simple and naive implementation of a map.
@@ -31,6 +36,15 @@
  * Besides that, we also need to optimize for insertion performance (the case
  * where a bunch of views appears on the screen first time); in this
  * implementation, this is as performant as vector `push_back`.
+ *
+ * Some maps are not tiny though (e.g. the children of a long list that is
+ * reordered), and linear lookups make the diffing of such lists quadratic. So
+ * once the map grows beyond `kIndexThreshold` entries, it additionally
+ * maintains an open-addressing hash index (linear probing) of positions in the
+ * vector. Appending and iteration still only touch the vector.
+ *
+ * If the same key is inserted several times, `find` returns the first
+ * non-erased entry, exactly like the linear lookup does.
  */
 template <typename KeyT, typename ValueT>
 class TinyMap final {
@@ -77,6 +91,11 @@ class TinyMap final {
       return end();
     }
 
+    if (!index_.empty()) {
+      auto slot = findSlot(key);
+      return index_[slot] == kEmptySlot ? end() : &vector_[index_[slot] - 1];
+    }
+
     for (auto it = begin_() + erasedAtFront_; it != end(); it++) {
       if (it->first == key) {
         return it;
@@ -90,10 +109,24 @@ class TinyMap final {
   {
     react_native_assert(pair.first != 0);
     vector_.push_back(pair);
+
+    if (index_.empty()) {
+      if (vector_.size() > kIndexThreshold) {
+        rebuildIndex();
+      }
+    } else if ((indexedCount_ + numTombstones_ + 1) * 2 > index_.size()) {
+      rebuildIndex();
+    } else {
+      indexPosition(vector_.size() - 1);
+    }
   }
 
   inline void erase(Iterator iterator)
   {
+    if (!index_.empty()) {
+      unindexPosition(static_cast<size_t>(iterator - &vector_.front()));
+    }
+
     // Invalidate tag.
     iterator->first = 0;
 
@@ -139,9 +172,125 @@ class TinyMap final {
     }
     numErased_ = 0;
     erasedAtFront_ = 0;
+
+    // Positions have changed.
+    if (!index_.empty()) {
+      rebuildIndex();
+    }
+  }
+
+  /*
+   * Index slots store a position in `vector_` plus one; zero marks an empty
+   * slot.
+   */
+  using Slot = uint32_t;
+  static constexpr Slot kEmptySlot = 0;
+  static constexpr Slot kTombstoneSlot = UINT32_MAX;
+
+  static constexpr size_t kIndexThreshold = 16;
+
+  inline size_t hashKey(KeyT key) const
+  {
+    // Fibonacci hashing spreads sequential tags over the whole table.
+    return static_cast<size_t>((static_cast<uint64_t>(std::hash<KeyT>{}(key)) * 0x9E3779B97F4A7C15ull) >> 32);
+  }
+
+  /**
+   * Returns the slot holding `key`, or the empty slot terminating its probe
+   * sequence.
+   */
+  inline size_t findSlot(KeyT key) const
+  {
+    auto mask = index_.size() - 1;
+    for (auto slot = hashKey(key) & mask;; slot = (slot + 1) & mask) {
+      auto value = index_[slot];
+      if (value == kEmptySlot || (value != kTombstoneSlot && vector_[value - 1].first == key)) {
+        return slot;
+      }
+    }
+  }
+
+  inline void indexPosition(size_t position)
+  {
+    auto key = vector_[position].first;
+    auto mask = index_.size() - 1;
+    auto firstTombstone = index_.size();
+
+    for (auto slot = hashKey(key) & mask;; slot = (slot + 1) & mask) {
+      auto value = index_[slot];
+
+      if (value == kTombstoneSlot) {
+        firstTombstone = std::min(firstTombstone, slot);
+        continue;
+      }
+
+      if (value == kEmptySlot) {
+        if (firstTombstone != index_.size()) {
+          slot = firstTombstone;
+          numTombstones_--;
+        }
+        index_[slot] = static_cast<Slot>(position + 1);
+        indexedCount_++;
+        return;
+      }
+
+      if (vector_[value - 1].first == key) {
+        // The earlier entry keeps shadowing this one until it is erased.
+        hasDuplicateKeys_ = true;
+        return;
+      }
+    }
+  }
+
+  inline void unindexPosition(size_t position)
+  {
+    auto key = vector_[position].first;
+    auto slot = findSlot(key);
+
+    if (index_[slot] != position + 1) {
+      // A shadowed duplicate, not referenced by the index.
+      return;
+    }
+
+    if (hasDuplicateKeys_) {
+      for (auto next = position + 1; next < vector_.size(); next++) {
+        if (vector_[next].first == key) {
+          index_[slot] = static_cast<Slot>(next + 1);
+          return;
+        }
+      }
+    }
+
+    index_[slot] = kTombstoneSlot;
+    indexedCount_--;
+    numTombstones_++;
+  }
+
+  inline void rebuildIndex()
+  {
+    auto capacity = size_t{kIndexThreshold * 4};
+    while (capacity < (vector_.size() - numErased_) * 4) {
+      capacity *= 2;
+    }
+
+    index_.assign(capacity, kEmptySlot);
+    indexedCount_ = 0;
+    numTombstones_ = 0;
+    hasDuplicateKeys_ = false;
+
+    for (size_t position = 0; position < vector_.size(); position++) {
+      if (vector_[position].first != 0) {
+        indexPosition(position);
+      }
+    }
   }
 
-  std::vector<Pair> vector_;
+  std::vector<Pair, facebook::react::DiffArenaAllocator<Pair>> vector_;
   size_t numErased_{0};
   size_t erasedAtFront_{0};
+
+  std::vector<Slot, facebook::react::DiffArenaAllocator<Slot>> index_;
+  size_t indexedCount_{0};
+  size_t numTombstones_{0};
+  bool hasDuplicateKeys_{false};
 };
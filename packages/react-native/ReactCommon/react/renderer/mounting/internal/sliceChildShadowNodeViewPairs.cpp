@@ -25,8 +25,7 @@ static bool shouldFirstPairComesBeforeSecondOne(
 /*
  * Reorders pairs in-place based on `orderIndex` using a stable sort algorithm.
  */
-static void reorderInPlaceIfNeeded(
-    std::vector<ShadowViewNodePair*>& pairs) noexcept {
+static void reorderInPlaceIfNeeded(ShadowViewNodePairList& pairs) noexcept {
   if (pairs.size() < 2) {
     return;
   }
@@ -48,7 +47,7 @@ static void reorderInPlaceIfNeeded(
 }
 
 static void sliceChildShadowNodeViewPairsRecursively(
-    std::vector<ShadowViewNodePair*>& pairList,
+    ShadowViewNodePairList& pairList,
     size_t& startOfStaticIndex,
     ViewNodePairScope& scope,
     Point layoutOffset,
@@ -164,14 +163,14 @@ static void sliceChildShadowNodeViewPairsRecursively(
   }
 }
 
-std::vector<ShadowViewNodePair*> sliceChildShadowNodeViewPairs(
+ShadowViewNodePairList sliceChildShadowNodeViewPairs(
     const ShadowViewNodePair& shadowNodePair,
     ViewNodePairScope& scope,
     bool allowFlattened,
     Point layoutOffset,
     const CullingContext& cullingContext) {
   const auto& shadowNode = *shadowNodePair.shadowNode;
-  auto pairList = std::vector<ShadowViewNodePair*>{};
+  auto pairList = ShadowViewNodePairList{};
 
   if (shadowNodePair.flattened && shadowNodePair.isConcreteView &&
       !allowFlattened) {
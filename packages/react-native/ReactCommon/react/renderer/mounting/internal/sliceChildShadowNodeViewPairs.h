@@ -8,8 +8,10 @@
 #pragma once
 
 #include <deque>
+#include <vector>
 
 #include "CullingContext.h"
+#include "DiffArena.h"
 
 namespace facebook::react {
 
@@ -35,15 +37,21 @@ struct ShadowViewNodePair;
  * both (1) ensures that pointers into the data-structure are never invalidated,
  * and (2) tries to efficiently allocate storage such that as many objects as
  * possible are close in memory, but does not guarantee adjacency.
+ *
+ * Both the scope and the pair lists referencing it allocate from the
+ * `DiffArena` of the ongoing diff (if any), so their storage is released in
+ * one go when the diff is done.
  */
-using ViewNodePairScope = std::deque<ShadowViewNodePair>;
+using ViewNodePairScope = std::deque<ShadowViewNodePair, DiffArenaAllocator<ShadowViewNodePair>>;
+
+using ShadowViewNodePairList = std::vector<ShadowViewNodePair *, DiffArenaAllocator<ShadowViewNodePair *>>;
 
 /**
  * Generates a list of `ShadowViewNodePair`s that represents a layer of a
  * flattened view hierarchy. The V2 version preserves nodes even if they do
  * not form views and their children are flattened.
  */
-std::vector<ShadowViewNodePair *> sliceChildShadowNodeViewPairs(
+ShadowViewNodePairList sliceChildShadowNodeViewPairs(
     const ShadowViewNodePair &shadowNodePair,
     ViewNodePairScope &viewNodePairScope,
     bool allowFlattened,
@@ -27,8 +27,7 @@ static bool shouldFirstPairComesBeforeSecondOne(
 /*
  * Reorders pairs in-place based on `orderIndex` using a stable sort algorithm.
  */
-static void reorderInPlaceIfNeeded(
-    std::vector<ShadowViewNodePair*>& pairs) noexcept {
+static void reorderInPlaceIfNeeded(ShadowViewNodePairList& pairs) noexcept {
   // This is a simplified version of the function intentionally copied from
   // `Differentiator.cpp`.
   std::stable_sort(
@@ -45,7 +44,7 @@ static void calculateShadowViewMutationsForNewTree(
     ShadowViewMutation::List& mutations,
     ViewNodePairScope& scope,
     const ShadowView& parentShadowView,
-    std::vector<ShadowViewNodePair*> newChildPairs) {
+    ShadowViewNodePairList newChildPairs) {
   // Sorting pairs based on `orderIndex` if needed.
   reorderInPlaceIfNeeded(newChildPairs);
 
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/mounting/internal/DiffArena.h>
+
+using namespace facebook::react;
+
+TEST(DiffArenaTest, allocatorFallsBackToHeapWithoutArena) {
+  DiffArena::resetStatistics();
+
+  auto vector = std::vector<int, DiffArenaAllocator<int>>{};
+  vector.reserve(16);
+
+  auto statistics = DiffArena::getStatistics();
+  EXPECT_EQ(statistics.allocationCount, 1);
+  EXPECT_EQ(statistics.heapAllocationCount, 1);
+  EXPECT_EQ(statistics.allocatedBytes, 16 * sizeof(int));
+}
+
+TEST(DiffArenaTest, allocationsAreServedFromArenaBlocks) {
+  DiffArena::resetStatistics();
+
+  {
+    DiffArena arena{};
+    EXPECT_EQ(DiffArena::current(), &arena);
+
+    for (int i = 0; i < 64; i++) {
+      auto vector = std::vector<int, DiffArenaAllocator<int>>{};
+      vector.reserve(4);
+      vector.push_back(i);
+      EXPECT_EQ(vector.front(), i);
+    }
+  }
+
+  EXPECT_EQ(DiffArena::current(), nullptr);
+
+  auto statistics = DiffArena::getStatistics();
+  EXPECT_EQ(statistics.allocationCount, 64);
+  EXPECT_EQ(statistics.heapAllocationCount, 1);
+}
+
+TEST(DiffArenaTest, arenasNestAndRespectAlignment) {
+  DiffArena outerArena{};
+
+  {
+    DiffArena innerArena{};
+    EXPECT_EQ(DiffArena::current(), &innerArena);
+
+    auto byte = innerArena.allocate(1, 1);
+    auto number = innerArena.allocate(sizeof(double), alignof(double));
+    EXPECT_NE(byte, number);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(number) % alignof(double), 0);
+
+    // Requests bigger than a block get a dedicated one.
+    auto large = innerArena.allocate(1024 * 1024, 16);
+    EXPECT_NE(large, nullptr);
+  }
+
+  EXPECT_EQ(DiffArena::current(), &outerArena);
+}
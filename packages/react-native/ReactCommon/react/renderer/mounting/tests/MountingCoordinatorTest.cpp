@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/stubs/stubs.h>
+
+namespace facebook::react {
+
+namespace {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& /*commitOptions*/) const override {
+    return newRootShadowNode;
+  }
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {}
+};
+
+} // namespace
+
+class MountingCoordinatorTest : public ::testing::Test {
+ protected:
+  MountingCoordinatorTest()
+      : builder_(simpleComponentBuilder()),
+        shadowTree_(
+            SurfaceId{1},
+            LayoutConstraints{},
+            LayoutContext{},
+            shadowTreeDelegate_,
+            contextContainer_) {
+    for (auto i = 0; i < kViewCount; i++) {
+      viewShadowNodes_[i] =
+          builder_.build(Element<ViewShadowNode>().tag(i + 2).surfaceId(1));
+    }
+  }
+
+  void commitInitialTree() {
+    shadowTree_.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return std::make_shared<RootShadowNode>(
+              oldRootShadowNode,
+              ShadowNodeFragment{
+                  .props = ShadowNodeFragment::propsPlaceholder(),
+                  .children = std::make_shared<
+                      std::vector<std::shared_ptr<const ShadowNode>>>(
+                      std::begin(viewShadowNodes_),
+                      std::end(viewShadowNodes_))});
+        },
+        {});
+  }
+
+  void commitOpacity(int viewIndex, Float opacity) {
+    shadowTree_.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return std::static_pointer_cast<RootShadowNode>(
+              oldRootShadowNode.cloneTree(
+                  viewShadowNodes_[viewIndex]->getFamily(),
+                  [&](const ShadowNode& oldShadowNode) {
+                    auto props = std::make_shared<ViewShadowNodeProps>();
+                    props->opacity = opacity;
+                    return oldShadowNode.clone({.props = props});
+                  }));
+        },
+        {});
+  }
+
+  static constexpr auto kViewCount = 8;
+
+  ComponentBuilder builder_;
+  ContextContainer contextContainer_{};
+  DummyShadowTreeDelegate shadowTreeDelegate_{};
+  ShadowTree shadowTree_;
+  std::shared_ptr<ViewShadowNode> viewShadowNodes_[kViewCount];
+};
+
+TEST_F(MountingCoordinatorTest, waitsForTransaction) {
+  auto mountingCoordinator = shadowTree_.getMountingCoordinator();
+  EXPECT_FALSE(mountingCoordinator->hasPendingTransactions());
+  EXPECT_FALSE(
+      mountingCoordinator->waitForTransaction(std::chrono::milliseconds(1)));
+
+  auto committer = std::thread([&]() {
+    commitInitialTree();
+  });
+  EXPECT_TRUE(mountingCoordinator->waitForTransaction(std::chrono::seconds(5)));
+  committer.join();
+
+  EXPECT_TRUE(mountingCoordinator->hasPendingTransactions());
+  EXPECT_TRUE(
+      mountingCoordinator->waitForTransaction(std::chrono::milliseconds(1)));
+  EXPECT_TRUE(mountingCoordinator->pullTransaction().has_value());
+  EXPECT_FALSE(mountingCoordinator->hasPendingTransactions());
+  EXPECT_FALSE(mountingCoordinator->pullTransaction().has_value());
+  EXPECT_FALSE(
+      mountingCoordinator->waitForTransaction(std::chrono::milliseconds(1)));
+}
+
+TEST_F(MountingCoordinatorTest, concurrentPushesAndPulls) {
+  constexpr auto kCommitterCount = 4;
+  constexpr auto kPullerCount = 4;
+  constexpr auto kCommitsPerCommitter = 200;
+
+  auto mountingCoordinator = shadowTree_.getMountingCoordinator();
+  auto viewTree =
+      StubViewTree(ShadowView(*mountingCoordinator->getBaseRevision()
+                                   .rootShadowNode));
+
+  commitInitialTree();
+
+  auto isCommitting = std::atomic<bool>{true};
+  auto transactionsMutex = std::mutex{};
+  auto transactions = std::vector<MountingTransaction>{};
+
+  auto pullers = std::vector<std::thread>{};
+  for (auto i = 0; i < kPullerCount; i++) {
+    pullers.emplace_back([&]() {
+      while (isCommitting) {
+        mountingCoordinator->waitForTransaction(std::chrono::milliseconds(1));
+        auto transaction = mountingCoordinator->pullTransaction();
+        if (transaction.has_value()) {
+          std::scoped_lock lock(transactionsMutex);
+          transactions.push_back(std::move(*transaction));
+        }
+      }
+    });
+  }
+
+  auto committers = std::vector<std::thread>{};
+  for (auto i = 0; i < kCommitterCount; i++) {
+    committers.emplace_back([&, i]() {
+      for (auto j = 0; j < kCommitsPerCommitter; j++) {
+        commitOpacity(
+            (i + j) % kViewCount,
+            static_cast<Float>(i * kCommitsPerCommitter + j + 1) /
+                (kCommitterCount * kCommitsPerCommitter));
+      }
+    });
+  }
+
+  for (auto& committer : committers) {
+    committer.join();
+  }
+  isCommitting = false;
+  for (auto& puller : pullers) {
+    puller.join();
+  }
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  if (transaction.has_value()) {
+    transactions.push_back(std::move(*transaction));
+  }
+  EXPECT_FALSE(mountingCoordinator->hasPendingTransactions());
+
+  ASSERT_FALSE(transactions.empty());
+
+  // Transactions are numbered in the order they were pulled and applying them
+  // in that order must produce the last committed tree.
+  std::sort(
+      transactions.begin(),
+      transactions.end(),
+      [](const MountingTransaction& lhs, const MountingTransaction& rhs) {
+        return lhs.getNumber() < rhs.getNumber();
+      });
+  for (size_t i = 0; i < transactions.size(); i++) {
+    EXPECT_EQ(transactions[i].getNumber(), i + 1);
+    viewTree.mutate(transactions[i].getMutations());
+  }
+
+  EXPECT_EQ(
+      viewTree,
+      buildStubViewTreeWithoutUsingDifferentiator(
+          *shadowTree_.getCurrentRevision().rootShadowNode));
+}
+
+} // namespace facebook::react
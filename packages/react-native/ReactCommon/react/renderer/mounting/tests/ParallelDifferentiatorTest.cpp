@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <vector>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/DifferentiatorWorkerPool.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+#include <react/renderer/mounting/stubs/stubs.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+static void expectEqualMutations(
+    const ShadowViewMutation::List& serialMutations,
+    const ShadowViewMutation::List& parallelMutations) {
+  ASSERT_EQ(serialMutations.size(), parallelMutations.size());
+
+  for (size_t i = 0; i < serialMutations.size(); i++) {
+    const auto& serialMutation = serialMutations[i];
+    const auto& parallelMutation = parallelMutations[i];
+
+    EXPECT_EQ(serialMutation.type, parallelMutation.type) << "at " << i;
+    EXPECT_EQ(serialMutation.parentTag, parallelMutation.parentTag)
+        << "at " << i;
+    EXPECT_EQ(serialMutation.index, parallelMutation.index) << "at " << i;
+    EXPECT_TRUE(
+        serialMutation.oldChildShadowView ==
+        parallelMutation.oldChildShadowView)
+        << "at " << i;
+    EXPECT_TRUE(
+        serialMutation.newChildShadowView ==
+        parallelMutation.newChildShadowView)
+        << "at " << i;
+  }
+}
+
+static void testParallelDiffingMatchesSerialDiffing(
+    uint_fast32_t seed,
+    int treeSize,
+    int repeats,
+    int stages,
+    size_t numberOfThreads) {
+  auto entropy = seed == 0 ? Entropy() : Entropy(seed);
+
+  auto workerPool = DifferentiatorWorkerPool(numberOfThreads);
+
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto componentDescriptorParameters = ComponentDescriptorParameters{
+      .eventDispatcher = eventDispatcher,
+      .contextContainer = contextContainer,
+      .flavor = nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+  auto rootComponentDescriptor =
+      RootComponentDescriptor(componentDescriptorParameters);
+
+  PropsParserContext parserContext{-1, *contextContainer};
+
+  for (int i = 0; i < repeats; i++) {
+    auto family = rootComponentDescriptor.createFamily(
+        {.tag = Tag(1), .surfaceId = SurfaceId(1), .instanceHandle = nullptr});
+
+    // Creating an initial root shadow node.
+    auto emptyRootNode = std::const_pointer_cast<RootShadowNode>(
+        std::static_pointer_cast<const RootShadowNode>(
+            rootComponentDescriptor.createShadowNode(
+                ShadowNodeFragment{
+                    .props = RootShadowNode::defaultSharedProps()},
+                family)));
+
+    // Applying size constraints.
+    emptyRootNode = emptyRootNode->clone(
+        parserContext,
+        LayoutConstraints{
+            .minimumSize = Size{.width = 512, .height = 0},
+            .maximumSize =
+                Size{
+                    .width = 512,
+                    .height = std::numeric_limits<Float>::infinity()}},
+        LayoutContext{});
+
+    // Generation of a random tree.
+    auto singleRootChildNode =
+        generateShadowNodeTree(entropy, viewComponentDescriptor, treeSize);
+
+    // Injecting a tree into the root node.
+    auto currentRootNode = std::static_pointer_cast<const RootShadowNode>(
+        emptyRootNode->ShadowNode::clone(
+            ShadowNodeFragment{
+                .props = ShadowNodeFragment::propsPlaceholder(),
+                .children = std::make_shared<
+                    std::vector<std::shared_ptr<const ShadowNode>>>(
+                    std::vector<std::shared_ptr<const ShadowNode>>{
+                        singleRootChildNode})}));
+
+    // Initial mount: everything is created and inserted.
+    expectEqualMutations(
+        calculateShadowViewMutations(*emptyRootNode, *currentRootNode),
+        calculateShadowViewMutations(
+            *emptyRootNode, *currentRootNode, workerPool));
+
+    auto viewTree = buildStubViewTreeWithoutUsingDifferentiator(*emptyRootNode);
+    viewTree.mutate(
+        calculateShadowViewMutations(
+            *emptyRootNode, *currentRootNode, workerPool));
+
+    for (int j = 0; j < stages; j++) {
+      auto nextRootNode = currentRootNode;
+
+      // Mutating the tree.
+      alterShadowTree(
+          entropy,
+          nextRootNode,
+          {
+              &messWithYogaStyles,
+              &messWithLayoutableOnlyFlag,
+          });
+      alterShadowTree(entropy, nextRootNode, &messWithNodeFlattenednessFlags);
+      alterShadowTree(entropy, nextRootNode, &messWithChildren);
+
+      std::vector<const LayoutableShadowNode*> affectedLayoutableNodes{};
+      affectedLayoutableNodes.reserve(1024);
+
+      // Laying out the tree.
+      std::const_pointer_cast<RootShadowNode>(nextRootNode)
+          ->layoutIfNeeded(&affectedLayoutableNodes);
+
+      nextRootNode->sealRecursive();
+
+      // Calculating mutations both ways.
+      auto serialMutations =
+          calculateShadowViewMutations(*currentRootNode, *nextRootNode);
+      auto parallelMutations = calculateShadowViewMutations(
+          *currentRootNode, *nextRootNode, workerPool);
+
+      expectEqualMutations(serialMutations, parallelMutations);
+      if (::testing::Test::HasFailure()) {
+        LOG(ERROR) << "Entropy seed: " << entropy.getSeed() << "\n";
+        return;
+      }
+
+      // The parallel output must also produce a correct view tree on its own.
+      viewTree.mutate(parallelMutations);
+      EXPECT_TRUE(
+          viewTree ==
+          buildStubViewTreeWithoutUsingDifferentiator(*nextRootNode));
+
+      currentRootNode = nextRootNode;
+    }
+  }
+}
+
+} // namespace facebook::react
+
+using namespace facebook::react;
+
+TEST(ParallelDifferentiatorTest, smallerTreesMoreIterations) {
+  testParallelDiffingMatchesSerialDiffing(
+      /* seed */ 1337,
+      /* size */ 32,
+      /* repeats */ 64,
+      /* stages */ 16,
+      /* threads */ 4);
+}
+
+TEST(ParallelDifferentiatorTest, biggerTreesFewerIterations) {
+  testParallelDiffingMatchesSerialDiffing(
+      /* seed */ 1,
+      /* size */ 512,
+      /* repeats */ 16,
+      /* stages */ 16,
+      /* threads */ 4);
+}
+
+TEST(ParallelDifferentiatorTest, biggerTreesSingleWorkerThread) {
+  testParallelDiffingMatchesSerialDiffing(
+      /* seed */ 0,
+      /* size */ 512,
+      /* repeats */ 8,
+      /* stages */ 16,
+      /* threads */ 1);
+}
+
+TEST(ParallelDifferentiatorTest, hugeTreesManyWorkerThreads) {
+  testParallelDiffingMatchesSerialDiffing(
+      /* seed */ 0,
+      /* size */ 4096,
+      /* repeats */ 2,
+      /* stages */ 8,
+      /* threads */ 8);
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/debug/react_native_assert.h>
+#include <react/renderer/mounting/internal/TinyMap.h>
+
+namespace {
+
+/*
+ * Reference model: `find` returns the first non-erased entry with the key.
+ */
+class ReferenceMap {
+ public:
+  void insert(int key, int value) {
+    entries_.push_back({key, value});
+  }
+
+  const std::pair<int, int>* find(int key) const {
+    for (const auto& entry : entries_) {
+      if (entry.first == key) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  void erase(int key) {
+    for (auto& entry : entries_) {
+      if (entry.first == key) {
+        entry.first = 0;
+        return;
+      }
+    }
+  }
+
+  size_t size() const {
+    size_t size = 0;
+    for (const auto& entry : entries_) {
+      size += entry.first != 0 ? 1 : 0;
+    }
+    return size;
+  }
+
+ private:
+  std::vector<std::pair<int, int>> entries_;
+};
+
+void testTinyMapMatchesReference(
+    uint_fast32_t seed,
+    int keyRange,
+    int operations) {
+  auto engine = std::mt19937{seed};
+  auto keyDistribution = std::uniform_int_distribution<int>{1, keyRange};
+  auto operationDistribution = std::uniform_int_distribution<int>{0, 9};
+
+  auto map = TinyMap<int, int>{};
+  auto reference = ReferenceMap{};
+
+  for (int i = 0; i < operations; i++) {
+    auto key = keyDistribution(engine);
+    auto operation = operationDistribution(engine);
+
+    if (operation < 5) {
+      map.insert({key, i});
+      reference.insert(key, i);
+    } else if (operation < 8) {
+      auto it = map.find(key);
+      auto expected = reference.find(key);
+      ASSERT_EQ(it != map.end(), expected != nullptr) << "key " << key;
+      if (expected != nullptr) {
+        EXPECT_EQ(it->second, expected->second) << "key " << key;
+        map.erase(it);
+        reference.erase(key);
+      }
+    } else {
+      auto it = map.find(key);
+      auto expected = reference.find(key);
+      ASSERT_EQ(it != map.end(), expected != nullptr) << "key " << key;
+      if (expected != nullptr) {
+        EXPECT_EQ(it->second, expected->second) << "key " << key;
+      }
+    }
+  }
+
+  size_t size = 0;
+  for (auto it = map.begin(); it != map.end(); it++) {
+    EXPECT_EQ(reference.find(it->first) != nullptr, true);
+    size++;
+  }
+  EXPECT_EQ(size, reference.size());
+}
+
+} // namespace
+
+TEST(TinyMapTest, smallMapsWithDuplicates) {
+  testTinyMapMatchesReference(
+      /* seed */ 1, /* keyRange */ 8, /* operations */ 10000);
+}
+
+TEST(TinyMapTest, largeMapsWithDuplicates) {
+  testTinyMapMatchesReference(
+      /* seed */ 2, /* keyRange */ 64, /* operations */ 20000);
+}
+
+TEST(TinyMapTest, largeMapsWithMostlyUniqueKeys) {
+  testTinyMapMatchesReference(
+      /* seed */ 3, /* keyRange */ 100000, /* operations */ 20000);
+}
+
+TEST(TinyMapTest, eraseInInsertionOrder) {
+  auto map = TinyMap<int, int>{};
+  for (int key = 1; key <= 1000; key++) {
+    map.insert({key, -key});
+  }
+
+  for (int key = 1; key <= 1000; key++) {
+    auto it = map.find(key);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, -key);
+    map.erase(it);
+    EXPECT_EQ(map.find(key), map.end());
+  }
+
+  EXPECT_EQ(map.begin(), map.end());
+}
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/stubs/stubs.h>
+#include <react/utils/ContextContainer.h>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Synthetic trees are perfect trees of `depth` levels (below the root) where
+ * every non-leaf node has `fanOut` children. Every benchmark runs on a pair of
+ * trees: an old one and a new one produced by applying `TreeUpdate` to every
+ * node of the old one.
+ */
+enum class TreeUpdate {
+  // Inserts a new leaf after every existing child.
+  Insert,
+  // Reverses the order of children.
+  Reorder,
+  // Toggles every node between forming a view and being layout-only.
+  Flatten,
+  // Changes a non-layout prop of every node.
+  Props,
+};
+
+struct SyntheticTrees {
+  std::shared_ptr<const RootShadowNode> oldRootShadowNode;
+  std::shared_ptr<const RootShadowNode> newRootShadowNode;
+  size_t nodeCount;
+};
+
+auto contextContainer = std::make_shared<const ContextContainer>();
+auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+auto componentDescriptorParameters = ComponentDescriptorParameters{
+    .eventDispatcher = eventDispatcher,
+    .contextContainer = contextContainer,
+    .flavor = nullptr};
+auto viewComponentDescriptor =
+    ViewComponentDescriptor{componentDescriptorParameters};
+auto rootComponentDescriptor =
+    RootComponentDescriptor{componentDescriptorParameters};
+
+static Props::Shared parseViewProps(const folly::dynamic& dynamic) {
+  auto parserContext = PropsParserContext{-1, *contextContainer};
+  return viewComponentDescriptor.cloneProps(
+      parserContext, nullptr, RawProps{dynamic});
+}
+
+auto viewProps = parseViewProps(
+    folly::dynamic::object("collapsable", false)("width", 10)("height", 10));
+auto updatedViewProps = parseViewProps(
+    folly::dynamic::object("collapsable", false)("width", 10)("height", 10)(
+        "opacity", 0.5));
+auto layoutOnlyViewProps =
+    parseViewProps(folly::dynamic::object("width", 10)("height", 10));
+
+static Tag generateTag() {
+  static Tag tag = 1000;
+  return tag++;
+}
+
+static std::shared_ptr<const ShadowNode> createViewShadowNode(
+    const Props::Shared& props,
+    std::vector<std::shared_ptr<const ShadowNode>> children) {
+  auto family = viewComponentDescriptor.createFamily(
+      {.tag = generateTag(),
+       .surfaceId = SurfaceId(1),
+       .instanceHandle = nullptr});
+  return viewComponentDescriptor.createShadowNode(
+      ShadowNodeFragment{
+          .props = props,
+          .children = std::make_shared<
+              const std::vector<std::shared_ptr<const ShadowNode>>>(
+              std::move(children))},
+      family);
+}
+
+static std::shared_ptr<const ShadowNode> generateSubtree(
+    int depth,
+    int fanOut,
+    size_t& nodeCount) {
+  nodeCount++;
+
+  auto children = std::vector<std::shared_ptr<const ShadowNode>>{};
+  if (depth > 1) {
+    children.reserve(fanOut);
+    for (int i = 0; i < fanOut; i++) {
+      children.push_back(generateSubtree(depth - 1, fanOut, nodeCount));
+    }
+  }
+
+  return createViewShadowNode(viewProps, std::move(children));
+}
+
+static std::shared_ptr<const ShadowNode> updateSubtree(
+    const ShadowNode& shadowNode,
+    TreeUpdate update) {
+  auto children = std::vector<std::shared_ptr<const ShadowNode>>{};
+  children.reserve(shadowNode.getChildren().size() * 2);
+
+  for (const auto& childShadowNode : shadowNode.getChildren()) {
+    children.push_back(updateSubtree(*childShadowNode, update));
+    if (update == TreeUpdate::Insert) {
+      children.push_back(createViewShadowNode(viewProps, {}));
+    }
+  }
+
+  if (update == TreeUpdate::Reorder) {
+    std::reverse(children.begin(), children.end());
+  }
+
+  auto props = ShadowNodeFragment::propsPlaceholder();
+  if (update == TreeUpdate::Flatten) {
+    props = shadowNode.getProps() == viewProps ? layoutOnlyViewProps
+                                               : viewProps;
+  } else if (update == TreeUpdate::Props) {
+    props = shadowNode.getProps() == viewProps ? updatedViewProps : viewProps;
+  }
+
+  return shadowNode.clone(
+      ShadowNodeFragment{
+          .props = props,
+          .children = std::make_shared<
+              const std::vector<std::shared_ptr<const ShadowNode>>>(
+              std::move(children))});
+}
+
+static std::shared_ptr<const RootShadowNode> createRootShadowNode(
+    const RootShadowNode& sourceRootShadowNode,
+    std::shared_ptr<const ShadowNode> childShadowNode) {
+  auto rootShadowNode = std::static_pointer_cast<RootShadowNode>(
+      sourceRootShadowNode.ShadowNode::clone(
+          ShadowNodeFragment{
+              .props = ShadowNodeFragment::propsPlaceholder(),
+              .children = std::make_shared<
+                  const std::vector<std::shared_ptr<const ShadowNode>>>(
+                  std::vector<std::shared_ptr<const ShadowNode>>{
+                      std::move(childShadowNode)})}));
+
+  rootShadowNode->layoutIfNeeded();
+  rootShadowNode->sealRecursive();
+  return rootShadowNode;
+}
+
+static LayoutConstraints syntheticLayoutConstraints() {
+  return LayoutConstraints{
+      .minimumSize = Size{.width = 512, .height = 0},
+      .maximumSize =
+          Size{
+              .width = 512,
+              .height = std::numeric_limits<Float>::infinity()}};
+}
+
+static std::shared_ptr<const RootShadowNode> createEmptyRootShadowNode() {
+  auto family = rootComponentDescriptor.createFamily(
+      {.tag = Tag(1), .surfaceId = SurfaceId(1), .instanceHandle = nullptr});
+  auto emptyRootShadowNode = std::static_pointer_cast<const RootShadowNode>(
+      rootComponentDescriptor.createShadowNode(
+          ShadowNodeFragment{.props = RootShadowNode::defaultSharedProps()},
+          family));
+
+  auto parserContext = PropsParserContext{-1, *contextContainer};
+  return emptyRootShadowNode->clone(
+      parserContext, syntheticLayoutConstraints(), LayoutContext{});
+}
+
+/*
+ * Trees are generated as children of `emptyRootShadowNode`, which must be the
+ * root of the `ShadowTree` they are going to be committed to (if any).
+ */
+static SyntheticTrees generateSyntheticTrees(
+    const benchmark::State& state,
+    TreeUpdate update,
+    const RootShadowNode& emptyRootShadowNode) {
+  auto depth = static_cast<int>(state.range(0));
+  auto fanOut = static_cast<int>(state.range(1));
+
+  auto nodeCount = size_t{0};
+  auto oldChildShadowNode = generateSubtree(depth, fanOut, nodeCount);
+  auto newChildShadowNode = updateSubtree(*oldChildShadowNode, update);
+
+  return SyntheticTrees{
+      .oldRootShadowNode =
+          createRootShadowNode(emptyRootShadowNode, oldChildShadowNode),
+      .newRootShadowNode =
+          createRootShadowNode(emptyRootShadowNode, newChildShadowNode),
+      .nodeCount = nodeCount};
+}
+
+class BenchmarkShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& /*commitOptions*/) const override {
+    return newRootShadowNode;
+  }
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {}
+};
+
+/*
+ * Commits a fresh (not laid out yet) clone of `rootShadowNode` children, so
+ * every commit goes through layout like a commit from React would.
+ */
+static void commitSyntheticTree(
+    const ShadowTree& shadowTree,
+    const RootShadowNode& rootShadowNode) {
+  shadowTree.commit(
+      [&](const RootShadowNode& oldRootShadowNode) {
+        return std::make_shared<RootShadowNode>(
+            oldRootShadowNode,
+            ShadowNodeFragment{
+                .props = ShadowNodeFragment::propsPlaceholder(),
+                .children = rootShadowNode.getChildren().empty()
+                    ? ShadowNode::emptySharedShadowNodeSharedList()
+                    : std::make_shared<
+                          const std::vector<std::shared_ptr<const ShadowNode>>>(
+                          rootShadowNode.getChildren())});
+      },
+      {.enableStateReconciliation = false});
+}
+
+static void differentiator(benchmark::State& state, TreeUpdate update) {
+  auto trees =
+      generateSyntheticTrees(state, update, *createEmptyRootShadowNode());
+  auto mutationCount = size_t{0};
+
+  for (auto _ : state) {
+    auto mutations = calculateShadowViewMutations(
+        *trees.oldRootShadowNode, *trees.newRootShadowNode);
+    mutationCount = mutations.size();
+    benchmark::DoNotOptimize(mutations);
+  }
+
+  state.counters["nodes"] = static_cast<double>(trees.nodeCount);
+  state.counters["mutations"] = static_cast<double>(mutationCount);
+}
+
+static void stubViewTreeMutation(benchmark::State& state, TreeUpdate update) {
+  auto trees =
+      generateSyntheticTrees(state, update, *createEmptyRootShadowNode());
+  auto mutations = calculateShadowViewMutations(
+      *trees.oldRootShadowNode, *trees.newRootShadowNode);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto stubViewTree =
+        buildStubViewTreeWithoutUsingDifferentiator(*trees.oldRootShadowNode);
+    state.ResumeTiming();
+
+    stubViewTree.mutate(mutations);
+  }
+
+  state.counters["nodes"] = static_cast<double>(trees.nodeCount);
+  state.counters["mutations"] = static_cast<double>(mutations.size());
+}
+
+static void shadowTreeCommit(benchmark::State& state, TreeUpdate update) {
+  auto delegate = BenchmarkShadowTreeDelegate{};
+  auto shadowTree = ShadowTree{
+      SurfaceId(1),
+      syntheticLayoutConstraints(),
+      LayoutContext{},
+      delegate,
+      *contextContainer};
+  auto trees = generateSyntheticTrees(
+      state, update, *shadowTree.getCurrentRevision().rootShadowNode);
+
+  auto shouldCommitNewTree = true;
+  for (auto _ : state) {
+    commitSyntheticTree(
+        shadowTree,
+        shouldCommitNewTree ? *trees.newRootShadowNode
+                            : *trees.oldRootShadowNode);
+    shouldCommitNewTree = !shouldCommitNewTree;
+  }
+
+  state.counters["nodes"] = static_cast<double>(trees.nodeCount);
+}
+
+static void mountingCoordinatorPullTransaction(
+    benchmark::State& state,
+    TreeUpdate update) {
+  auto delegate = BenchmarkShadowTreeDelegate{};
+  auto shadowTree = ShadowTree{
+      SurfaceId(1),
+      syntheticLayoutConstraints(),
+      LayoutContext{},
+      delegate,
+      *contextContainer};
+  auto trees = generateSyntheticTrees(
+      state, update, *shadowTree.getCurrentRevision().rootShadowNode);
+  auto mountingCoordinator = shadowTree.getMountingCoordinator();
+
+  // Mounting the old tree first, so every measured transaction is an update.
+  commitSyntheticTree(shadowTree, *trees.oldRootShadowNode);
+  mountingCoordinator->pullTransaction();
+
+  auto shouldCommitNewTree = true;
+  auto mutationCount = size_t{0};
+  for (auto _ : state) {
+    state.PauseTiming();
+    commitSyntheticTree(
+        shadowTree,
+        shouldCommitNewTree ? *trees.newRootShadowNode
+                            : *trees.oldRootShadowNode);
+    shouldCommitNewTree = !shouldCommitNewTree;
+    state.ResumeTiming();
+
+    auto transaction = mountingCoordinator->pullTransaction();
+    mutationCount = transaction->getMutations().size();
+    benchmark::DoNotOptimize(transaction);
+  }
+
+  state.counters["nodes"] = static_cast<double>(trees.nodeCount);
+  state.counters["mutations"] = static_cast<double>(mutationCount);
+}
+
+/*
+ * {depth, fanOut}: small, balanced, wide and deep trees.
+ */
+static void syntheticTreeShapes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"depth", "fanOut"})
+      ->Args({3, 4})
+      ->Args({4, 6})
+      ->Args({2, 32})
+      ->Args({9, 2})
+      ->Unit(benchmark::kMicrosecond);
+}
+
+/*
+ * {depth, fanOut}: a single parent with many children, e.g. a long list.
+ * Every shape is above the size at which `TinyMap` starts indexing entries.
+ */
+static void wideTreeShapes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"depth", "fanOut"})
+      ->Args({2, 32})
+      ->Args({2, 100})
+      ->Args({2, 1000})
+      ->Args({2, 3000})
+      ->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_CAPTURE(differentiator, insert, TreeUpdate::Insert)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(differentiator, reorder, TreeUpdate::Reorder)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(differentiator, flatten, TreeUpdate::Flatten)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(differentiator, props, TreeUpdate::Props)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(differentiator, wideReorder, TreeUpdate::Reorder)
+    ->Apply(wideTreeShapes);
+
+BENCHMARK_CAPTURE(stubViewTreeMutation, insert, TreeUpdate::Insert)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(stubViewTreeMutation, reorder, TreeUpdate::Reorder)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(stubViewTreeMutation, flatten, TreeUpdate::Flatten)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(stubViewTreeMutation, props, TreeUpdate::Props)
+    ->Apply(syntheticTreeShapes);
+
+BENCHMARK_CAPTURE(shadowTreeCommit, insert, TreeUpdate::Insert)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(shadowTreeCommit, reorder, TreeUpdate::Reorder)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(shadowTreeCommit, flatten, TreeUpdate::Flatten)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(shadowTreeCommit, props, TreeUpdate::Props)
+    ->Apply(syntheticTreeShapes);
+
+BENCHMARK_CAPTURE(
+    mountingCoordinatorPullTransaction,
+    insert,
+    TreeUpdate::Insert)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(
+    mountingCoordinatorPullTransaction,
+    reorder,
+    TreeUpdate::Reorder)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(
+    mountingCoordinatorPullTransaction,
+    flatten,
+    TreeUpdate::Flatten)
+    ->Apply(syntheticTreeShapes);
+BENCHMARK_CAPTURE(mountingCoordinatorPullTransaction, props, TreeUpdate::Props)
+    ->Apply(syntheticTreeShapes);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
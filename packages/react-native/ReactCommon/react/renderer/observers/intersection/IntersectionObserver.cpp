@@ -14,6 +14,8 @@
 #include <react/renderer/css/CSSPercentage.h>
 #include <react/renderer/css/CSSValueParser.h>
 #include <react/renderer/graphics/RectangleEdges.h>
+#include <algorithm>
+#include <unordered_map>
 #include <utility>
 
 namespace facebook::react {
@@ -68,6 +70,89 @@ std::vector<MarginValue> parseNormalizedRootMargin(
 
 namespace {
 
+bool hasSameLayout(
+    const ShadowNode& oldShadowNode,
+    const ShadowNode& newShadowNode) {
+  // Props hold transforms and clipping, and state holds scroll offsets.
+  if (oldShadowNode.getProps() != newShadowNode.getProps() ||
+      oldShadowNode.getState() != newShadowNode.getState()) {
+    return false;
+  }
+
+  auto oldLayoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&oldShadowNode);
+  auto newLayoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&newShadowNode);
+  if (oldLayoutableShadowNode == nullptr ||
+      newLayoutableShadowNode == nullptr) {
+    return oldLayoutableShadowNode == newLayoutableShadowNode;
+  }
+
+  return oldLayoutableShadowNode->getLayoutMetrics() ==
+      newLayoutableShadowNode->getLayoutMetrics();
+}
+
+} // namespace
+
+void collectFamiliesWithChangedLayout(
+    const ShadowNode& oldShadowNode,
+    const ShadowNode& newShadowNode,
+    ShadowNodeFamilySet& families) {
+  if (&oldShadowNode == &newShadowNode) {
+    return;
+  }
+
+  if (!hasSameLayout(oldShadowNode, newShadowNode)) {
+    // Descendants are affected through this node, so they are not visited.
+    families.insert(&newShadowNode.getFamily());
+    return;
+  }
+
+  const auto& oldChildren = oldShadowNode.getChildren();
+  const auto& newChildren = newShadowNode.getChildren();
+  if (&oldChildren == &newChildren) {
+    return;
+  }
+
+  // Children usually keep their positions, unless some of them were added,
+  // removed or reordered.
+  auto haveSameFamilies = oldChildren.size() == newChildren.size();
+  for (size_t i = 0; haveSameFamilies && i < newChildren.size(); i++) {
+    haveSameFamilies =
+        &oldChildren[i]->getFamily() == &newChildren[i]->getFamily();
+  }
+
+  if (haveSameFamilies) {
+    for (size_t i = 0; i < newChildren.size(); i++) {
+      collectFamiliesWithChangedLayout(
+          *oldChildren[i], *newChildren[i], families);
+    }
+    return;
+  }
+
+  auto oldChildrenByFamily =
+      std::unordered_map<const ShadowNodeFamily*, const ShadowNode*>{};
+  for (const auto& oldChild : oldChildren) {
+    oldChildrenByFamily.emplace(&oldChild->getFamily(), oldChild.get());
+  }
+
+  for (const auto& newChild : newChildren) {
+    auto it = oldChildrenByFamily.find(&newChild->getFamily());
+    if (it == oldChildrenByFamily.end()) {
+      families.insert(&newChild->getFamily());
+    } else {
+      collectFamiliesWithChangedLayout(*it->second, *newChild, families);
+      oldChildrenByFamily.erase(it);
+    }
+  }
+
+  for (const auto& [family, oldChild] : oldChildrenByFamily) {
+    families.insert(family);
+  }
+}
+
+namespace {
+
 // Convert margin values to actual pixel values based on root rect.
 // Per W3C spec: top/bottom percentages use height, left/right use width.
 EdgeInsets calculateRootMarginInsets(
@@ -266,12 +351,25 @@ IntersectionObserver::updateIntersectionObservation(
   // Absolute coordinates of the target
   auto targetBoundingRect = getBoundingRect(targetAncestors);
 
+  observedFamilies_.clear();
+
   if ((hasExplicitRoot && rootAncestors.empty()) || targetAncestors.empty()) {
     // If observation root or target is not a descendant of `rootShadowNode`
     return setNotIntersectingState(
         rootMarginBoundingRect, targetBoundingRect, {}, time);
   }
 
+  for (const auto& ancestor : rootAncestors) {
+    observedFamilies_.push_back(&ancestor.first.get().getFamily());
+  }
+  if (hasExplicitRoot) {
+    observedFamilies_.push_back(observationRootShadowNodeFamily_->get());
+  }
+  for (const auto& ancestor : targetAncestors) {
+    observedFamilies_.push_back(&ancestor.first.get().getFamily());
+  }
+  observedFamilies_.push_back(targetShadowNodeFamily_.get());
+
   auto targetToRootAncestors = hasExplicitRoot
       ? targetShadowNodeFamily_->getAncestors(*getShadowNode(rootAncestors))
       : targetAncestors;
@@ -333,9 +431,24 @@ IntersectionObserver::updateIntersectionObservation(
 std::optional<IntersectionObserverEntry>
 IntersectionObserver::updateIntersectionObservationForSurfaceUnmount(
     HighResTimeStamp time) {
+  observedFamilies_.clear();
   return setNotIntersectingState(Rect{}, Rect{}, Rect{}, time);
 }
 
+bool IntersectionObserver::isAffectedByChangedFamilies(
+    const ShadowNodeFamilySet& changedFamilies) const {
+  if (observedFamilies_.empty()) {
+    return true;
+  }
+
+  return std::any_of(
+      observedFamilies_.begin(),
+      observedFamilies_.end(),
+      [&](const ShadowNodeFamily* family) {
+        return changedFamilies.contains(family);
+      });
+}
+
 std::optional<IntersectionObserverEntry>
 IntersectionObserver::setIntersectingState(
     const Rect& rootBoundingRect,
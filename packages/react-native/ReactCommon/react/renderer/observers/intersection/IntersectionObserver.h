@@ -12,6 +12,7 @@
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/Rect.h>
 #include <memory>
+#include <unordered_set>
 #include "IntersectionObserverState.h"
 
 namespace facebook::react {
@@ -30,6 +31,18 @@ struct MarginValue {
 // Returns a vector of 4 MarginValue structures (top, right, bottom, left).
 std::vector<MarginValue> parseNormalizedRootMargin(const std::string &marginStr);
 
+using ShadowNodeFamilySet = std::unordered_set<const ShadowNodeFamily *>;
+
+// Collects the families of the nodes of the tree of `newShadowNode` whose
+// layout metrics, props or state differ from the same nodes in the tree of
+// `oldShadowNode`, as well as of nodes that were added or removed. These are
+// the only nodes that can move or clip themselves and their descendants.
+// Subtrees shared by both trees are skipped.
+void collectFamiliesWithChangedLayout(
+    const ShadowNode &oldShadowNode,
+    const ShadowNode &newShadowNode,
+    ShadowNodeFamilySet &families);
+
 struct IntersectionObserverEntry {
   IntersectionObserverObserverId intersectionObserverId;
   ShadowNodeFamily::Shared shadowNodeFamily;
@@ -63,6 +76,18 @@ class IntersectionObserver {
 
   std::optional<IntersectionObserverEntry> updateIntersectionObservationForSurfaceUnmount(HighResTimeStamp time);
 
+  // Returns whether the observation needs to be updated for a tree in which
+  // the nodes of `changedFamilies` changed since the tree of the last update.
+  // Always `true` if the target or the root were not found in that tree.
+  bool isAffectedByChangedFamilies(const ShadowNodeFamilySet &changedFamilies) const;
+
+  // Makes the next observation update unconditional, e.g. if the last update
+  // was for a different tree than the one that changes are collected from.
+  void invalidateObservedFamilies()
+  {
+    observedFamilies_.clear();
+  }
+
   IntersectionObserverObserverId getIntersectionObserverId() const
   {
     return intersectionObserverId_;
@@ -101,6 +126,9 @@ class IntersectionObserver {
   // Parsed and expanded rootMargin values (top, right, bottom, left)
   std::vector<MarginValue> rootMargins_;
   mutable IntersectionObserverState state_ = IntersectionObserverState::Initial();
+  // Families of the target, the root and their ancestors in the tree of the
+  // last update, which are the only nodes that affect the observation.
+  std::vector<const ShadowNodeFamily *> observedFamilies_;
 };
 
 } // namespace facebook::react
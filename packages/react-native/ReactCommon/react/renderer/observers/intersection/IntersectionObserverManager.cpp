@@ -53,7 +53,7 @@ void IntersectionObserverManager::observe(
   // Register observer
   std::unique_lock lock(observersMutex_);
 
-  auto& observers = observersBySurfaceId_[surfaceId];
+  auto& observers = observersBySurfaceId_[surfaceId].observers;
 
   // Parse rootMargin string into MarginValue structures
   // Default to "0px 0px 0px 0px" if not provided
@@ -101,7 +101,7 @@ void IntersectionObserverManager::unobserve(
       return;
     }
 
-    auto& observers = observersIt->second;
+    auto& observers = observersIt->second.observers;
 
     observers.erase(
         std::remove_if(
@@ -227,8 +227,24 @@ void IntersectionObserverManager::updateIntersectionObservations(
       continue;
     }
 
-    auto entry = observer->updateIntersectionObservation(
-        *rootShadowNode, HighResTimeStamp::now());
+    std::optional<IntersectionObserverEntry> entry;
+    {
+      std::shared_lock lock(observersMutex_);
+
+      auto observersIt = observersBySurfaceId_.find(surfaceId);
+      if (observersIt == observersBySurfaceId_.end()) {
+        continue;
+      }
+
+      // The mount hooks might be updating the observations of this surface
+      // concurrently.
+      std::lock_guard surfaceLock(observersIt->second.mutex);
+      entry = observer->updateIntersectionObservation(
+          *rootShadowNode, HighResTimeStamp::now());
+      // This tree is not necessarily the one the next mount is compared to.
+      observer->invalidateObservedFamilies();
+    }
+
     if (entry) {
       {
         std::unique_lock lock(pendingEntriesMutex_);
@@ -248,7 +264,7 @@ void IntersectionObserverManager::shadowTreeDidMount(
     HighResTimeStamp time) noexcept {
   TraceSection s("IntersectionObserverManager::shadowTreeDidMount");
   updateIntersectionObservations(
-      rootShadowNode->getSurfaceId(), rootShadowNode.get(), time);
+      rootShadowNode->getSurfaceId(), rootShadowNode, time);
 }
 
 void IntersectionObserverManager::shadowTreeDidUnmount(
@@ -262,7 +278,7 @@ void IntersectionObserverManager::shadowTreeDidUnmount(
 
 void IntersectionObserverManager::updateIntersectionObservations(
     SurfaceId surfaceId,
-    const RootShadowNode* rootShadowNode,
+    const RootShadowNode::Shared& rootShadowNode,
     HighResTimeStamp time) {
   std::vector<IntersectionObserverEntry> entries;
 
@@ -275,16 +291,31 @@ void IntersectionObserverManager::updateIntersectionObservations(
       return;
     }
 
+    auto& surfaceObservers = observersIt->second;
+    std::lock_guard surfaceLock(surfaceObservers.mutex);
+
     TraceSection s(
         "IntersectionObserverManager::updateIntersectionObservations(mount)",
         "observerCount",
-        observersIt->second.size());
+        surfaceObservers.observers.size());
+
+    // Only observations of targets or roots that were moved or clipped
+    // differently since the previous mount can change.
+    auto previousRootShadowNode = std::move(surfaceObservers.rootShadowNode);
+    auto changedFamilies = ShadowNodeFamilySet{};
+    if (previousRootShadowNode != nullptr && rootShadowNode != nullptr) {
+      collectFamiliesWithChangedLayout(
+          *previousRootShadowNode, *rootShadowNode, changedFamilies);
+    }
 
-    auto& observers = observersIt->second;
-    for (auto& observer : observers) {
+    for (auto& observer : surfaceObservers.observers) {
       std::optional<IntersectionObserverEntry> entry;
 
       if (rootShadowNode != nullptr) {
+        if (previousRootShadowNode != nullptr &&
+            !observer->isAffectedByChangedFamilies(changedFamilies)) {
+          continue;
+        }
         entry = observer->updateIntersectionObservation(*rootShadowNode, time);
       } else {
         entry = observer->updateIntersectionObservationForSurfaceUnmount(time);
@@ -294,6 +325,8 @@ void IntersectionObserverManager::updateIntersectionObservations(
         entries.push_back(std::move(entry).value());
       }
     }
+
+    surfaceObservers.rootShadowNode = rootShadowNode;
   }
 
   {
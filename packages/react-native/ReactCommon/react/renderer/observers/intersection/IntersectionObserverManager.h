@@ -14,6 +14,7 @@
 #include <react/renderer/uimanager/UIManager.h>
 #include <react/renderer/uimanager/UIManagerMountHook.h>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include "IntersectionObserver.h"
 
@@ -56,7 +57,22 @@ class IntersectionObserverManager final : public UIManagerMountHook,
   void shadowTreeDidUnmount(SurfaceId surfaceId, HighResTimeStamp time) noexcept override;
 
  private:
-  mutable std::unordered_map<SurfaceId, std::vector<std::unique_ptr<IntersectionObserver>>> observersBySurfaceId_;
+  struct SurfaceObservers {
+    std::vector<std::unique_ptr<IntersectionObserver>> observers;
+
+    // The tree of the last mount that observations were updated for, which
+    // the next mounted tree is compared to in order to only update the
+    // observations affected by the changes.
+    RootShadowNode::Shared rootShadowNode;
+
+    // Serializes the updates of the observations of the surface, which happen
+    // both in the mount hooks and on the JS thread for new observers, and
+    // protects `rootShadowNode`. The observers themselves are protected by
+    // `observersMutex_`.
+    std::mutex mutex;
+  };
+
+  mutable std::unordered_map<SurfaceId, SurfaceObservers> observersBySurfaceId_;
   mutable std::shared_mutex observersMutex_;
 
   // This is defined as a list of pointers to keep the ownership of the
@@ -82,7 +98,10 @@ class IntersectionObserverManager final : public UIManagerMountHook,
 
   // Equivalent to
   // https://w3c.github.io/IntersectionObserver/#update-intersection-observations-algo
-  void updateIntersectionObservations(SurfaceId surfaceId, const RootShadowNode *rootShadowNode, HighResTimeStamp time);
+  void updateIntersectionObservations(
+      SurfaceId surfaceId,
+      const RootShadowNode::Shared &rootShadowNode,
+      HighResTimeStamp time);
 
   const IntersectionObserver &getRegisteredIntersectionObserver(
       SurfaceId surfaceId,
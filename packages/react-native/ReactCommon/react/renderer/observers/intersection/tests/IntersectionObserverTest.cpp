@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/observers/intersection/IntersectionObserver.h>
+
+namespace facebook::react {
+
+namespace {
+
+LayoutMetrics layoutMetricsWithFrame(Rect frame) {
+  auto layoutMetrics = EmptyLayoutMetrics;
+  layoutMetrics.frame = frame;
+  return layoutMetrics;
+}
+
+} // namespace
+
+class IntersectionObserverTest : public ::testing::Test {
+ protected:
+  IntersectionObserverTest() : builder_(simpleComponentBuilder()) {
+    /*
+     * <Root>
+     *   <View container>
+     *     <View first />
+     *     <View second />
+     *   </View>
+     *   <View sibling />
+     * </Root>
+     */
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .finalize([](RootShadowNode &shadowNode) {
+            shadowNode.setLayoutMetrics(
+                layoutMetricsWithFrame({.size = {.width = 400, .height = 800}}));
+          })
+          .children({
+            Element<ViewShadowNode>()
+              .reference(containerShadowNode_)
+              .finalize([](ViewShadowNode &shadowNode) {
+                shadowNode.setLayoutMetrics(layoutMetricsWithFrame(
+                    {.size = {.width = 400, .height = 800}}));
+              })
+              .children({
+                Element<ViewShadowNode>()
+                  .reference(firstShadowNode_)
+                  .finalize([](ViewShadowNode &shadowNode) {
+                    shadowNode.setLayoutMetrics(layoutMetricsWithFrame(
+                        {.size = {.width = 100, .height = 100}}));
+                  }),
+                Element<ViewShadowNode>()
+                  .reference(secondShadowNode_)
+                  .finalize([](ViewShadowNode &shadowNode) {
+                    shadowNode.setLayoutMetrics(layoutMetricsWithFrame(
+                        {.origin = {.x = 0, .y = 200},
+                         .size = {.width = 100, .height = 100}}));
+                  }),
+              }),
+            Element<ViewShadowNode>()
+              .reference(siblingShadowNode_)
+          });
+    // clang-format on
+
+    rootShadowNode_ = builder_.build(element);
+  }
+
+  std::shared_ptr<const RootShadowNode> cloneWithFrame(
+      const ShadowNodeFamily& family,
+      Rect frame) {
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootShadowNode_->cloneTree(
+            family, [&](const ShadowNode& oldShadowNode) {
+              auto newShadowNode = oldShadowNode.clone({});
+              std::static_pointer_cast<ViewShadowNode>(newShadowNode)
+                  ->setLayoutMetrics(layoutMetricsWithFrame(frame));
+              return newShadowNode;
+            }));
+  }
+
+  ShadowNodeFamilySet collectFamiliesWithChangedLayout(
+      const ShadowNode& newRootShadowNode) {
+    auto families = ShadowNodeFamilySet{};
+    facebook::react::collectFamiliesWithChangedLayout(
+        *rootShadowNode_, newRootShadowNode, families);
+    return families;
+  }
+
+  IntersectionObserver createIntersectionObserver(
+      const ShadowNodeFamily::Shared& targetFamily) {
+    return IntersectionObserver{
+        1, std::nullopt, targetFamily, {0}, std::nullopt, {}};
+  }
+
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> containerShadowNode_;
+  std::shared_ptr<ViewShadowNode> firstShadowNode_;
+  std::shared_ptr<ViewShadowNode> secondShadowNode_;
+  std::shared_ptr<ViewShadowNode> siblingShadowNode_;
+};
+
+TEST_F(IntersectionObserverTest, collectsOnlyFamiliesWithChangedLayout) {
+  EXPECT_THAT(
+      collectFamiliesWithChangedLayout(*rootShadowNode_), ::testing::IsEmpty());
+
+  auto clonedRootShadowNode = rootShadowNode_->cloneTree(
+      firstShadowNode_->getFamily(), [](const ShadowNode& oldShadowNode) {
+        return oldShadowNode.clone({});
+      });
+  EXPECT_THAT(
+      collectFamiliesWithChangedLayout(*clonedRootShadowNode),
+      ::testing::IsEmpty());
+
+  auto movedRootShadowNode = cloneWithFrame(
+      secondShadowNode_->getFamily(),
+      {.origin = {.x = 0, .y = 300}, .size = {.width = 100, .height = 100}});
+  EXPECT_THAT(
+      collectFamiliesWithChangedLayout(*movedRootShadowNode),
+      ::testing::UnorderedElementsAre(&secondShadowNode_->getFamily()));
+}
+
+TEST_F(IntersectionObserverTest, collectsAddedAndRemovedFamilies) {
+  auto reorderedRootShadowNode = rootShadowNode_->cloneTree(
+      containerShadowNode_->getFamily(), [&](const ShadowNode& oldShadowNode) {
+        return oldShadowNode.clone(
+            {.children = std::make_shared<
+                 std::vector<std::shared_ptr<const ShadowNode>>>(
+                 std::vector<std::shared_ptr<const ShadowNode>>{
+                     secondShadowNode_, firstShadowNode_})});
+      });
+  EXPECT_THAT(
+      collectFamiliesWithChangedLayout(*reorderedRootShadowNode),
+      ::testing::IsEmpty());
+
+  auto removedRootShadowNode = rootShadowNode_->cloneTree(
+      containerShadowNode_->getFamily(), [&](const ShadowNode& oldShadowNode) {
+        return oldShadowNode.clone(
+            {.children = std::make_shared<
+                 std::vector<std::shared_ptr<const ShadowNode>>>(
+                 std::vector<std::shared_ptr<const ShadowNode>>{
+                     secondShadowNode_})});
+      });
+  EXPECT_THAT(
+      collectFamiliesWithChangedLayout(*removedRootShadowNode),
+      ::testing::UnorderedElementsAre(&firstShadowNode_->getFamily()));
+
+  auto families = ShadowNodeFamilySet{};
+  facebook::react::collectFamiliesWithChangedLayout(
+      *removedRootShadowNode, *rootShadowNode_, families);
+  EXPECT_THAT(
+      families, ::testing::UnorderedElementsAre(&firstShadowNode_->getFamily()));
+}
+
+TEST_F(IntersectionObserverTest, isOnlyAffectedByChangesOfItsAncestors) {
+  auto intersectionObserver =
+      createIntersectionObserver(firstShadowNode_->getFamilyShared());
+  EXPECT_TRUE(intersectionObserver.isAffectedByChangedFamilies({}));
+
+  auto entry = intersectionObserver.updateIntersectionObservation(
+      *rootShadowNode_, HighResTimeStamp::now());
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_TRUE(entry->isIntersectingAboveThresholds);
+
+  EXPECT_FALSE(intersectionObserver.isAffectedByChangedFamilies({}));
+  EXPECT_FALSE(intersectionObserver.isAffectedByChangedFamilies(
+      {&secondShadowNode_->getFamily(), &siblingShadowNode_->getFamily()}));
+  EXPECT_TRUE(intersectionObserver.isAffectedByChangedFamilies(
+      {&firstShadowNode_->getFamily()}));
+  EXPECT_TRUE(intersectionObserver.isAffectedByChangedFamilies(
+      {&containerShadowNode_->getFamily()}));
+  EXPECT_TRUE(intersectionObserver.isAffectedByChangedFamilies(
+      {&rootShadowNode_->getFamily()}));
+
+  intersectionObserver.invalidateObservedFamilies();
+  EXPECT_TRUE(intersectionObserver.isAffectedByChangedFamilies({}));
+}
+
+TEST_F(IntersectionObserverTest, skippedObservationsWouldNotChange) {
+  auto intersectionObserver =
+      createIntersectionObserver(firstShadowNode_->getFamilyShared());
+  ASSERT_TRUE(intersectionObserver
+                  .updateIntersectionObservation(
+                      *rootShadowNode_, HighResTimeStamp::now())
+                  .has_value());
+
+  // Moving another target does not affect the observation.
+  auto movedRootShadowNode = cloneWithFrame(
+      secondShadowNode_->getFamily(),
+      {.origin = {.x = 0, .y = 900}, .size = {.width = 100, .height = 100}});
+  EXPECT_FALSE(intersectionObserver.isAffectedByChangedFamilies(
+      collectFamiliesWithChangedLayout(*movedRootShadowNode)));
+  EXPECT_FALSE(intersectionObserver
+                   .updateIntersectionObservation(
+                       *movedRootShadowNode, HighResTimeStamp::now())
+                   .has_value());
+
+  // Moving the container of the target out of the root does.
+  auto movedContainerRootShadowNode = cloneWithFrame(
+      containerShadowNode_->getFamily(),
+      {.origin = {.x = 0, .y = 900}, .size = {.width = 400, .height = 800}});
+  EXPECT_TRUE(intersectionObserver.isAffectedByChangedFamilies(
+      collectFamiliesWithChangedLayout(*movedContainerRootShadowNode)));
+  auto entry = intersectionObserver.updateIntersectionObservation(
+      *movedContainerRootShadowNode, HighResTimeStamp::now());
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_FALSE(entry->isIntersectingAboveThresholds);
+}
+
+} // namespace facebook::react
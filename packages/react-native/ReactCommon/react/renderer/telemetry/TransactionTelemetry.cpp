@@ -46,6 +46,62 @@ void TransactionTelemetry::didCommit() {
   commitEndTime_ = now_();
 }
 
+void TransactionTelemetry::willRunTransaction() {
+  react_native_assert(transactionStartTime_ == kTelemetryUndefinedTimePoint);
+  react_native_assert(transactionEndTime_ == kTelemetryUndefinedTimePoint);
+  transactionStartTime_ = now_();
+}
+
+void TransactionTelemetry::didRunTransaction() {
+  react_native_assert(transactionStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(transactionEndTime_ == kTelemetryUndefinedTimePoint);
+  transactionEndTime_ = now_();
+}
+
+void TransactionTelemetry::willReconcileState() {
+  react_native_assert(
+      stateReconciliationStartTime_ == kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      stateReconciliationEndTime_ == kTelemetryUndefinedTimePoint);
+  stateReconciliationStartTime_ = now_();
+}
+
+void TransactionTelemetry::didReconcileState() {
+  react_native_assert(
+      stateReconciliationStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      stateReconciliationEndTime_ == kTelemetryUndefinedTimePoint);
+  stateReconciliationEndTime_ = now_();
+}
+
+void TransactionTelemetry::willRunCommitHooks() {
+  react_native_assert(commitHooksStartTime_ == kTelemetryUndefinedTimePoint);
+  react_native_assert(commitHooksEndTime_ == kTelemetryUndefinedTimePoint);
+  commitHooksStartTime_ = now_();
+}
+
+void TransactionTelemetry::didRunCommitHooks() {
+  react_native_assert(commitHooksStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(commitHooksEndTime_ == kTelemetryUndefinedTimePoint);
+  commitHooksEndTime_ = now_();
+}
+
+void TransactionTelemetry::willAcquireCommitLock() {
+  react_native_assert(
+      commitLockAcquisitionStartTime_ == kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      commitLockAcquisitionEndTime_ == kTelemetryUndefinedTimePoint);
+  commitLockAcquisitionStartTime_ = now_();
+}
+
+void TransactionTelemetry::didAcquireCommitLock() {
+  react_native_assert(
+      commitLockAcquisitionStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      commitLockAcquisitionEndTime_ == kTelemetryUndefinedTimePoint);
+  commitLockAcquisitionEndTime_ = now_();
+}
+
 void TransactionTelemetry::willDiff() {
   react_native_assert(diffStartTime_ == kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ == kTelemetryUndefinedTimePoint);
@@ -129,6 +185,65 @@ TelemetryTimePoint TransactionTelemetry::getCommitEndTime() const {
   return commitEndTime_;
 }
 
+TelemetryTimePoint TransactionTelemetry::getTransactionStartTime() const {
+  react_native_assert(transactionStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(transactionEndTime_ != kTelemetryUndefinedTimePoint);
+  return transactionStartTime_;
+}
+
+TelemetryTimePoint TransactionTelemetry::getTransactionEndTime() const {
+  react_native_assert(transactionStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(transactionEndTime_ != kTelemetryUndefinedTimePoint);
+  return transactionEndTime_;
+}
+
+TelemetryTimePoint TransactionTelemetry::getStateReconciliationStartTime()
+    const {
+  react_native_assert(
+      stateReconciliationStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      stateReconciliationEndTime_ != kTelemetryUndefinedTimePoint);
+  return stateReconciliationStartTime_;
+}
+
+TelemetryTimePoint TransactionTelemetry::getStateReconciliationEndTime() const {
+  react_native_assert(
+      stateReconciliationStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      stateReconciliationEndTime_ != kTelemetryUndefinedTimePoint);
+  return stateReconciliationEndTime_;
+}
+
+TelemetryTimePoint TransactionTelemetry::getCommitHooksStartTime() const {
+  react_native_assert(commitHooksStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(commitHooksEndTime_ != kTelemetryUndefinedTimePoint);
+  return commitHooksStartTime_;
+}
+
+TelemetryTimePoint TransactionTelemetry::getCommitHooksEndTime() const {
+  react_native_assert(commitHooksStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(commitHooksEndTime_ != kTelemetryUndefinedTimePoint);
+  return commitHooksEndTime_;
+}
+
+TelemetryTimePoint TransactionTelemetry::getCommitLockAcquisitionStartTime()
+    const {
+  react_native_assert(
+      commitLockAcquisitionStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      commitLockAcquisitionEndTime_ != kTelemetryUndefinedTimePoint);
+  return commitLockAcquisitionStartTime_;
+}
+
+TelemetryTimePoint TransactionTelemetry::getCommitLockAcquisitionEndTime()
+    const {
+  react_native_assert(
+      commitLockAcquisitionStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      commitLockAcquisitionEndTime_ != kTelemetryUndefinedTimePoint);
+  return commitLockAcquisitionEndTime_;
+}
+
 TelemetryTimePoint TransactionTelemetry::getLayoutStartTime() const {
   react_native_assert(layoutStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(layoutEndTime_ != kTelemetryUndefinedTimePoint);
@@ -39,6 +39,14 @@ class TransactionTelemetry final {
   void didDiff();
   void willCommit();
   void didCommit();
+  void willRunTransaction();
+  void didRunTransaction();
+  void willReconcileState();
+  void didReconcileState();
+  void willRunCommitHooks();
+  void didRunCommitHooks();
+  void willAcquireCommitLock();
+  void didAcquireCommitLock();
   void willLayout();
   void willMeasureText();
   void didMeasureText();
@@ -58,6 +66,19 @@ class TransactionTelemetry final {
   TelemetryTimePoint getLayoutEndTime() const;
   TelemetryTimePoint getCommitStartTime() const;
   TelemetryTimePoint getCommitEndTime() const;
+
+  /*
+   * Phases of a commit. Reading the time points of a phase which did not
+   * happen (e.g. state reconciliation for a commit without it) asserts.
+   */
+  TelemetryTimePoint getTransactionStartTime() const;
+  TelemetryTimePoint getTransactionEndTime() const;
+  TelemetryTimePoint getStateReconciliationStartTime() const;
+  TelemetryTimePoint getStateReconciliationEndTime() const;
+  TelemetryTimePoint getCommitHooksStartTime() const;
+  TelemetryTimePoint getCommitHooksEndTime() const;
+  TelemetryTimePoint getCommitLockAcquisitionStartTime() const;
+  TelemetryTimePoint getCommitLockAcquisitionEndTime() const;
   TelemetryTimePoint getMountStartTime() const;
   TelemetryTimePoint getMountEndTime() const;
 
@@ -72,6 +93,14 @@ class TransactionTelemetry final {
   TelemetryTimePoint diffEndTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint commitStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint commitEndTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint transactionStartTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint transactionEndTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint stateReconciliationStartTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint stateReconciliationEndTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint commitHooksStartTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint commitHooksEndTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint commitLockAcquisitionStartTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint commitLockAcquisitionEndTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint layoutStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint layoutEndTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint mountStartTime_{kTelemetryUndefinedTimePoint};
@@ -97,6 +97,57 @@ TEST(TransactionTelemetryTest, normalUseCase) {
   EXPECT_EQ(telemetry.getRevisionNumber(), 42);
 }
 
+TEST(TransactionTelemetryTest, commitPhases) {
+  auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+
+  telemetry.willCommit();
+  telemetry.willRunTransaction();
+  MockClock::advance_by(std::chrono::milliseconds(100));
+  telemetry.didRunTransaction();
+  telemetry.willReconcileState();
+  MockClock::advance_by(std::chrono::milliseconds(200));
+  telemetry.didReconcileState();
+  telemetry.willRunCommitHooks();
+  MockClock::advance_by(std::chrono::milliseconds(300));
+  telemetry.didRunCommitHooks();
+  telemetry.willLayout();
+  MockClock::advance_by(std::chrono::milliseconds(400));
+  telemetry.didLayout();
+  telemetry.willAcquireCommitLock();
+  MockClock::advance_by(std::chrono::milliseconds(500));
+  telemetry.didAcquireCommitLock();
+  telemetry.didCommit();
+
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(
+          telemetry.getTransactionEndTime() -
+          telemetry.getTransactionStartTime()),
+      100);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(
+          telemetry.getStateReconciliationEndTime() -
+          telemetry.getStateReconciliationStartTime()),
+      200);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(
+          telemetry.getCommitHooksEndTime() -
+          telemetry.getCommitHooksStartTime()),
+      300);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(
+          telemetry.getLayoutEndTime() - telemetry.getLayoutStartTime()),
+      400);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(
+          telemetry.getCommitLockAcquisitionEndTime() -
+          telemetry.getCommitLockAcquisitionStartTime()),
+      500);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(
+          telemetry.getCommitEndTime() - telemetry.getCommitStartTime()),
+      1500);
+}
+
 TEST(TransactionTelemetryTest, defaultImplementation) {
   auto telemetry = TransactionTelemetry{};
 
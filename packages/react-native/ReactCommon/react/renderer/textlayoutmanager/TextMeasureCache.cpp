@@ -7,10 +7,85 @@
 
 #include "TextMeasureCache.h"
 
+#include <jsinspector-modern/tracing/PerformanceTracer.h>
 #include <utility>
 
 namespace facebook::react {
 
+namespace {
+
+// Bookkeeping of a single cache entry: a list node, a hash map node
+// (including its bucket) and the control block of the shared entry.
+constexpr size_t kMeasureCacheEntryOverhead = 10 * sizeof(void*);
+
+size_t estimateSize(const AttributedString& attributedString) {
+  auto size = sizeof(AttributedString);
+  for (const auto& fragment : attributedString.getFragments()) {
+    size += sizeof(AttributedString::Fragment) + fragment.string.capacity() +
+        fragment.textAttributes.fontFamily.capacity();
+  }
+  return size;
+}
+
+} // namespace
+
+size_t textMeasureCacheSizeInBytes(const ContextContainer* contextContainer) {
+  if (contextContainer != nullptr) {
+    if (auto sizeInBytes =
+            contextContainer->find<size_t>("TextMeasureCacheSizeInBytes")) {
+      return *sizeInBytes;
+    }
+  }
+  return kTextMeasureCacheSizeInBytes;
+}
+
+size_t measureCacheEntrySize(
+    const TextMeasureCacheKey& key,
+    const TextMeasurement& value) {
+  return kMeasureCacheEntryOverhead + sizeof(key) +
+      estimateSize(key.attributedString) + sizeof(value) +
+      value.attachments.capacity() * sizeof(TextMeasurement::Attachment);
+}
+
+size_t measureCacheEntrySize(
+    const LineMeasureCacheKey& key,
+    const LinesMeasurements& value) {
+  auto size = kMeasureCacheEntryOverhead + sizeof(key) +
+      estimateSize(key.attributedString) + sizeof(value) +
+      value.capacity() * sizeof(LineMeasurement);
+  for (const auto& line : value) {
+    size += line.text.capacity();
+  }
+  return size;
+}
+
+void reportMeasureCacheStatistics(
+    const char* cacheName,
+    size_t maximumSizeInBytes,
+    const MeasureCacheStatistics& statistics) {
+  auto& performanceTracer =
+      jsinspector_modern::tracing::PerformanceTracer::getInstance();
+  if (!performanceTracer.isTracing()) {
+    return;
+  }
+
+  auto detail = folly::dynamic::object("hitCount", statistics.hitCount)(
+      "missCount", statistics.missCount)(
+      "evictionCount", statistics.evictionCount)(
+      "entryCount", statistics.entryCount)(
+      "sizeInBytes", statistics.sizeInBytes)(
+      "maximumSizeInBytes", maximumSizeInBytes);
+
+  performanceTracer.reportTimeStamp(
+      cacheName,
+      HighResTimeStamp::now(),
+      std::nullopt,
+      "Text Measure Cache",
+      std::nullopt,
+      std::nullopt,
+      std::move(detail));
+}
+
 static Rect rectFromDynamic(const folly::dynamic& data) {
   Point origin;
   origin.x = static_cast<Float>(data.getDefault("x", 0).getDouble());
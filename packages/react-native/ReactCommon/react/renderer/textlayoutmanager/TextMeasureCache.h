@@ -7,10 +7,14 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <react/renderer/attributedstring/AttributedString.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
+#include <react/utils/ContextContainer.h>
 #include <react/utils/FloatComparison.h>
+#include <react/utils/ShardedThreadSafeCache.h>
 #include <react/utils/SimpleThreadSafeCache.h>
 #include <react/utils/hash_combine.h>
 
@@ -96,17 +100,126 @@ class PreparedTextCacheKey final {
  */
 constexpr auto kSimpleThreadSafeCacheSizeCap = size_t{1024};
 
+/*
+ * Default memory budget of a single measure cache.
+ * Text-heavy surfaces easily exceed a thousand distinct measurements, so the
+ * cache is bounded by the (estimated) memory its entries retain rather than by
+ * their count.
+ */
+constexpr auto kTextMeasureCacheSizeInBytes = size_t{2 * 1024 * 1024};
+
+/*
+ * Returns the memory budget of a measure cache, which an app can override by
+ * registering a `size_t` under the "TextMeasureCacheSizeInBytes" key in the
+ * ContextContainer.
+ */
+size_t textMeasureCacheSizeInBytes(const ContextContainer *contextContainer);
+
+/*
+ * Snapshot of the counters maintained by a `ShardedMeasureCache`.
+ */
+struct MeasureCacheStatistics {
+  size_t hitCount{0};
+  size_t missCount{0};
+  size_t evictionCount{0};
+  size_t entryCount{0};
+  size_t sizeInBytes{0};
+};
+
+/*
+ * Estimates the amount of memory retained by a cache entry, including the
+ * heap-allocated parts of the key and the value.
+ */
+size_t measureCacheEntrySize(const TextMeasureCacheKey &key, const TextMeasurement &value);
+size_t measureCacheEntrySize(const LineMeasureCacheKey &key, const LinesMeasurements &value);
+
+/*
+ * Reports the statistics of the cache with given name on the performance
+ * timeline. No-op if the performance tracer is not tracing.
+ */
+void reportMeasureCacheStatistics(
+    const char *cacheName,
+    size_t maximumSizeInBytes,
+    const MeasureCacheStatistics &statistics);
+
+/*
+ * Thread-safe, size-bounded LRU cache designed to store measurement
+ * information.
+ * Backed by a `ShardedThreadSafeCache` whose entries are weighed by the memory
+ * they retain, so concurrent measurements of different strings don't contend
+ * on a single mutex and each shard evicts its least recently used entries once
+ * its share of the memory budget is exceeded.
+ */
+template <typename KeyT, typename ValueT>
+class ShardedMeasureCache final {
+ public:
+  ShardedMeasureCache(const char *name, size_t maximumSizeInBytes = kTextMeasureCacheSizeInBytes)
+      : name_(name),
+        maximumSizeInBytes_(maximumSizeInBytes),
+        cache_(maximumSizeInBytes, [](const KeyT &key, const ValueT &value) {
+          return measureCacheEntrySize(key, value);
+        })
+  {
+  }
+
+  /*
+   * Returns a value from the cache with a given key.
+   * If the value wasn't found in the cache, constructs the value using given
+   * generator function, stores it inside a cache and returns it.
+   * Can be called from any thread.
+   */
+  ValueT get(const KeyT &key, CacheGeneratorFunction<ValueT> auto generator) const
+  {
+    auto value = cache_.get(key, std::move(generator));
+
+    auto lookupCount = lookupCount_.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (lookupCount % kStatisticsReportingInterval == 0) {
+      reportMeasureCacheStatistics(name_, maximumSizeInBytes_, getStatistics());
+    }
+
+    return value;
+  }
+
+  /*
+   * Returns a snapshot of the cache counters.
+   * Can be called from any thread.
+   */
+  MeasureCacheStatistics getStatistics() const
+  {
+    auto statistics = cache_.getStatistics();
+    return MeasureCacheStatistics{
+        .hitCount = statistics.hitCount,
+        .missCount = statistics.missCount,
+        .evictionCount = statistics.evictionCount,
+        .entryCount = statistics.entryCount,
+        .sizeInBytes = statistics.weight};
+  }
+
+  size_t getMaximumSizeInBytes() const
+  {
+    return maximumSizeInBytes_;
+  }
+
+ private:
+  static constexpr size_t kStatisticsReportingInterval = 1024;
+
+  const char *name_;
+  size_t maximumSizeInBytes_;
+  ShardedThreadSafeCache<KeyT, ValueT, -1> cache_;
+  mutable std::atomic<size_t> lookupCount_{0};
+};
+
 /*
  * Thread-safe, evicting hash table designed to store text measurement
  * information.
  */
-using TextMeasureCache = SimpleThreadSafeCache<TextMeasureCacheKey, TextMeasurement, kSimpleThreadSafeCacheSizeCap>;
+using TextMeasureCache = ShardedMeasureCache<TextMeasureCacheKey, TextMeasurement>;
 
 /*
  * Thread-safe, evicting hash table designed to store line measurement
  * information.
  */
-using LineMeasureCache = SimpleThreadSafeCache<LineMeasureCacheKey, LinesMeasurements, kSimpleThreadSafeCacheSizeCap>;
+using LineMeasureCache = ShardedMeasureCache<LineMeasureCacheKey, LinesMeasurements>;
 
 inline bool areTextAttributesEquivalentLayoutWise(const TextAttributes &lhs, const TextAttributes &rhs)
 {
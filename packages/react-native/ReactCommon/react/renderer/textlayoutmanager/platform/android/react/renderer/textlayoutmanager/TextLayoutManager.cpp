@@ -157,8 +157,12 @@ TextMeasurement doMeasure(
 TextLayoutManager::TextLayoutManager(
     const std::shared_ptr<const ContextContainer>& contextContainer)
     : contextContainer_(std::move(contextContainer)),
-      textMeasureCache_(kSimpleThreadSafeCacheSizeCap),
-      lineMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      textMeasureCache_(
+          "TextMeasureCache",
+          textMeasureCacheSizeInBytes(contextContainer.get())),
+      lineMeasureCache_(
+          "LineMeasureCache",
+          textMeasureCacheSizeInBytes(contextContainer.get())),
       preparedTextCache_(
           static_cast<size_t>(
               ReactNativeFeatureFlags::preparedTextCacheSize())) {}
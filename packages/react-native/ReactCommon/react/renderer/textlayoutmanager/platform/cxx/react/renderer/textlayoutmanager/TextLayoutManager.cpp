@@ -10,8 +10,10 @@
 namespace facebook::react {
 
 TextLayoutManager::TextLayoutManager(
-    const std::shared_ptr<const ContextContainer>& /*contextContainer*/)
-    : textMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
+    const std::shared_ptr<const ContextContainer>& contextContainer)
+    : textMeasureCache_(
+          "TextMeasureCache",
+          textMeasureCacheSizeInBytes(contextContainer.get())) {}
 
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox& attributedStringBox,
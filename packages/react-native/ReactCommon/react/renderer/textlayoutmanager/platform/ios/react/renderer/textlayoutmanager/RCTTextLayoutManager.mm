@@ -13,12 +13,12 @@
 #import <React/RCTUtils.h>
 #import <react/featureflags/ReactNativeFeatureFlags.h>
 #import <react/utils/ManagedObjectWrapper.h>
-#import <react/utils/SimpleThreadSafeCache.h>
+#import <react/utils/ShardedThreadSafeCache.h>
 
 using namespace facebook::react;
 
 @implementation RCTTextLayoutManager {
-  SimpleThreadSafeCache<AttributedString, std::shared_ptr<void>, 256> _cache;
+  ShardedThreadSafeCache<AttributedString, std::shared_ptr<void>, 256> _cache;
 }
 
 static NSLineBreakMode RCTNSLineBreakModeFromEllipsizeMode(EllipsizeMode ellipsizeMode)
@@ -14,7 +14,9 @@
 
 namespace facebook::react {
 
-TextLayoutManager::TextLayoutManager(const std::shared_ptr<const ContextContainer> & /*contextContainer*/)
+TextLayoutManager::TextLayoutManager(const std::shared_ptr<const ContextContainer> &contextContainer)
+    : textMeasureCache_("TextMeasureCache", textMeasureCacheSizeInBytes(contextContainer.get())),
+      lineMeasureCache_("LineMeasureCache", textMeasureCacheSizeInBytes(contextContainer.get()))
 {
   nativeTextLayoutManager_ = wrapManagedObject([RCTTextLayoutManager new]);
 }
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+
+using namespace facebook::react;
+
+namespace {
+
+TextMeasureCacheKey textMeasureCacheKey(const std::string& string) {
+  auto attributedString = AttributedString{};
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = string;
+  fragment.textAttributes.fontSize = 14;
+  attributedString.appendFragment(std::move(fragment));
+  return {.attributedString = std::move(attributedString)};
+}
+
+TextMeasurement textMeasurement(Float width) {
+  return {.size = {.width = width, .height = 10}};
+}
+
+} // namespace
+
+TEST(TextMeasureCacheTest, countsHitsAndMisses) {
+  auto cache = TextMeasureCache{"TextMeasureCache"};
+  auto generatorCalls = 0;
+  auto generator = [&]() {
+    generatorCalls++;
+    return textMeasurement(42);
+  };
+
+  EXPECT_EQ(cache.get(textMeasureCacheKey("a"), generator).size.width, 42);
+  EXPECT_EQ(cache.get(textMeasureCacheKey("a"), generator).size.width, 42);
+  EXPECT_EQ(cache.get(textMeasureCacheKey("b"), generator).size.width, 42);
+  EXPECT_EQ(generatorCalls, 2);
+
+  auto statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.hitCount, 1);
+  EXPECT_EQ(statistics.missCount, 2);
+  EXPECT_EQ(statistics.evictionCount, 0);
+  EXPECT_EQ(statistics.entryCount, 2);
+  EXPECT_GT(statistics.sizeInBytes, 0);
+}
+
+TEST(TextMeasureCacheTest, evictsEntriesOverMemoryBudget) {
+  auto key = textMeasureCacheKey("measure me");
+  auto entrySize = measureCacheEntrySize(key, textMeasurement(0));
+
+  // Leaves room for roughly four entries in total.
+  auto cache = TextMeasureCache{"TextMeasureCache", entrySize * 4};
+
+  for (int i = 0; i < 1000; i++) {
+    cache.get(textMeasureCacheKey(std::to_string(i)), [&]() {
+      return textMeasurement(static_cast<Float>(i));
+    });
+  }
+
+  auto statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.missCount, 1000);
+  EXPECT_EQ(statistics.evictionCount, 1000 - statistics.entryCount);
+  EXPECT_LT(statistics.entryCount, 1000);
+
+  // Every shard keeps at least its most recent entry.
+  EXPECT_LE(
+      statistics.sizeInBytes,
+      cache.getMaximumSizeInBytes() + entrySize * statistics.entryCount);
+}
+
+TEST(TextMeasureCacheTest, keepsEntriesLargerThanShardBudget) {
+  auto key = textMeasureCacheKey("x");
+  auto entrySize = measureCacheEntrySize(key, textMeasurement(0));
+
+  // A budget that fits only a single small entry per shard.
+  auto cache = TextMeasureCache{"TextMeasureCache", entrySize * 8};
+
+  cache.get(key, []() { return textMeasurement(1); });
+  cache.get(key, []() { return textMeasurement(2); });
+  EXPECT_EQ(cache.get(key, []() { return textMeasurement(3); }).size.width, 1);
+
+  // A long string exceeds the budget of its shard on its own, but the most
+  // recent entry is never evicted.
+  auto longKey = textMeasureCacheKey(std::string(4096, 'y'));
+  cache.get(longKey, []() { return textMeasurement(4); });
+  EXPECT_EQ(
+      cache.get(longKey, []() { return textMeasurement(5); }).size.width, 4);
+}
+
+TEST(TextMeasureCacheTest, supportsConcurrentAccess) {
+  auto cache = TextMeasureCache{"TextMeasureCache"};
+  auto threads = std::vector<std::thread>{};
+  auto mismatchCount = std::atomic<int>{0};
+
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < 1000; i++) {
+        auto index = (i * 7 + t) % 64;
+        auto measurement =
+            cache.get(textMeasureCacheKey(std::to_string(index)), [&]() {
+              return textMeasurement(static_cast<Float>(index));
+            });
+        if (measurement.size.width != static_cast<Float>(index)) {
+          mismatchCount++;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto statistics = cache.getStatistics();
+  EXPECT_EQ(mismatchCount, 0);
+  EXPECT_EQ(statistics.hitCount + statistics.missCount, 8000);
+  EXPECT_EQ(statistics.entryCount, 64);
+}
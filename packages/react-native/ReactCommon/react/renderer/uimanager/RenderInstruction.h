@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ShadowNode.h>
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <variant>
+
+namespace facebook::react {
+
+/*
+ * Opcodes of a render instruction buffer.
+ * Each instruction is a 32-bit opcode followed by its 32-bit operands, and
+ * has the same effect as the `nativeFabricUIManager` call it is named after.
+ * Nodes and child sets are referred to by their index in the list of values
+ * the instructions operate on; created ones are appended to that list.
+ */
+enum class RenderInstruction : int32_t {
+  /*
+   * Operands: tag, index of the component name.
+   * Creates a node from the next entry of the props table.
+   */
+  CreateNode = 0,
+
+  /*
+   * Operands: index of the parent node, index of the child node.
+   */
+  AppendChild = 1,
+
+  /*
+   * Creates an empty child set.
+   */
+  CreateChildSet = 2,
+
+  /*
+   * Operands: index of the child set, index of the child node.
+   */
+  AppendChildToSet = 3,
+};
+
+/*
+ * A node or a child set operated on by render instructions.
+ */
+using RenderInstructionValue = std::variant<std::shared_ptr<const ShadowNode>, ShadowNode::UnsharedListOfShared>;
+
+/*
+ * Returns the number of operands that follow the given opcode.
+ * Throws `std::invalid_argument` for unknown opcodes.
+ */
+inline size_t renderInstructionOperandCount(RenderInstruction instruction)
+{
+  switch (instruction) {
+    case RenderInstruction::CreateNode:
+    case RenderInstruction::AppendChild:
+    case RenderInstruction::AppendChildToSet:
+      return 2;
+    case RenderInstruction::CreateChildSet:
+      return 0;
+  }
+  throw std::invalid_argument("Unknown render instruction");
+}
+
+/*
+ * Returns the number of `CreateNode` instructions in a buffer, which is the
+ * number of props and instance handles executing it consumes.
+ * Throws `std::logic_error` if the buffer is malformed.
+ */
+inline size_t countCreateNodeRenderInstructions(std::span<const int32_t> instructions)
+{
+  size_t count = 0;
+  size_t position = 0;
+  while (position < instructions.size()) {
+    auto instruction = static_cast<RenderInstruction>(instructions[position]);
+    position += 1 + renderInstructionOperandCount(instruction);
+    if (position > instructions.size()) {
+      throw std::out_of_range("Render instructions are truncated");
+    }
+    if (instruction == RenderInstruction::CreateNode) {
+      count++;
+    }
+  }
+  return count;
+}
+
+} // namespace facebook::react
@@ -182,6 +182,76 @@ void UIManager::appendChild(
   componentDescriptor.appendChild(parentShadowNode, childShadowNode);
 }
 
+void UIManager::executeRenderInstructions(
+    SurfaceId surfaceId,
+    std::span<const int32_t> instructions,
+    const std::vector<std::string>& componentNames,
+    std::vector<RawProps> props,
+    const std::function<InstanceHandle::Shared(size_t index, Tag tag)>&
+        createInstanceHandle,
+    std::vector<RenderInstructionValue>& values) const {
+  TraceSection s("UIManager::executeRenderInstructions");
+
+  size_t position = 0;
+  auto nextWord = [&]() {
+    if (position >= instructions.size()) {
+      throw std::out_of_range("Render instructions are truncated");
+    }
+    return instructions[position++];
+  };
+  auto shadowNodeAt = [&](int32_t index) {
+    auto shadowNode = std::get_if<std::shared_ptr<const ShadowNode>>(
+        &values.at(static_cast<size_t>(index)));
+    if (shadowNode == nullptr) {
+      throw std::invalid_argument("Render instruction operand is not a node");
+    }
+    return *shadowNode;
+  };
+
+  size_t nodeIndex = 0;
+  while (position < instructions.size()) {
+    switch (static_cast<RenderInstruction>(nextWord())) {
+      case RenderInstruction::CreateNode: {
+        auto tag = static_cast<Tag>(nextWord());
+        const auto& componentName =
+            componentNames.at(static_cast<size_t>(nextWord()));
+        auto rawProps = std::move(props.at(nodeIndex));
+        values.emplace_back(createNode(
+            tag,
+            componentName,
+            surfaceId,
+            std::move(rawProps),
+            createInstanceHandle(nodeIndex, tag)));
+        nodeIndex++;
+        break;
+      }
+      case RenderInstruction::AppendChild: {
+        auto parentShadowNode = shadowNodeAt(nextWord());
+        auto childShadowNode = shadowNodeAt(nextWord());
+        appendChild(parentShadowNode, childShadowNode);
+        break;
+      }
+      case RenderInstruction::CreateChildSet: {
+        values.emplace_back(
+            std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>());
+        break;
+      }
+      case RenderInstruction::AppendChildToSet: {
+        auto shadowNodeList = std::get_if<ShadowNode::UnsharedListOfShared>(
+            &values.at(static_cast<size_t>(nextWord())));
+        if (shadowNodeList == nullptr) {
+          throw std::invalid_argument(
+              "Render instruction operand is not a child set");
+        }
+        (*shadowNodeList)->push_back(shadowNodeAt(nextWord()));
+        break;
+      }
+      default:
+        throw std::invalid_argument("Unknown render instruction");
+    }
+  }
+}
+
 void UIManager::completeSurface(
     SurfaceId surfaceId,
     const ShadowNode::UnsharedListOfShared& rootChildren,
@@ -347,12 +417,21 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
   auto owningAncestorShadowNode = std::shared_ptr<const ShadowNode>{};
 
   if (ancestorShadowNode == nullptr) {
+    auto rootShadowNode = RootShadowNode::Shared{};
     shadowTreeRegistry_.visit(
         shadowNode.getSurfaceId(), [&](const ShadowTree& shadowTree) {
-          owningAncestorShadowNode =
-              shadowTree.getCurrentRevision().rootShadowNode;
-          ancestorShadowNode = owningAncestorShadowNode.get();
+          rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
         });
+
+    if (rootShadowNode != nullptr &&
+        !ShadowNode::sameFamily(*rootShadowNode, shadowNode)) {
+      // Measurements relative to the root are memoized by the revision.
+      return rootShadowNode->getLayoutMetricsOfDescendant(
+          shadowNode.getFamily(), policy);
+    }
+
+    owningAncestorShadowNode = rootShadowNode;
+    ancestorShadowNode = owningAncestorShadowNode.get();
   } else {
     // It is possible for JavaScript (or other callers) to have a reference
     // to a previous version of ShadowNodes, but we enforce that
@@ -12,6 +12,7 @@
 
 #include <ReactCommon/RuntimeExecutor.h>
 #include <shared_mutex>
+#include <span>
 
 #include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
 #include <react/renderer/consistency/ShadowTreeRevisionConsistencyManager.h>
@@ -23,6 +24,7 @@
 #include <react/renderer/mounting/ShadowTree.h>
 #include <react/renderer/mounting/ShadowTreeDelegate.h>
 #include <react/renderer/mounting/ShadowTreeRegistry.h>
+#include <react/renderer/uimanager/RenderInstruction.h>
 #include <react/renderer/uimanager/UIManagerAnimationBackend.h>
 #include <react/renderer/uimanager/UIManagerAnimationDelegate.h>
 #include <react/renderer/uimanager/UIManagerDelegate.h>
@@ -149,6 +151,23 @@ class UIManager final : public ShadowTreeDelegate {
       const std::shared_ptr<const ShadowNode> &parentShadowNode,
       const std::shared_ptr<const ShadowNode> &childShadowNode) const;
 
+  /*
+   * Executes a buffer of `RenderInstruction`s, which has the same effect as
+   * making the `createNode`, `appendChild`, `createChildSet` and
+   * `appendChildToSet` calls it encodes one by one.
+   * The n-th created node gets `props[n]` and the instance handle returned by
+   * `createInstanceHandle(n, tag)`. Operands refer to `values`, to which every
+   * created node and child set is appended.
+   * Throws `std::logic_error` if the buffer is malformed.
+   */
+  void executeRenderInstructions(
+      SurfaceId surfaceId,
+      std::span<const int32_t> instructions,
+      const std::vector<std::string> &componentNames,
+      std::vector<RawProps> props,
+      const std::function<InstanceHandle::Shared(size_t index, Tag tag)> &createInstanceHandle,
+      std::vector<RenderInstructionValue> &values) const;
+
   void completeSurface(
       SurfaceId surfaceId,
       const ShadowNode::UnsharedListOfShared &rootChildren,
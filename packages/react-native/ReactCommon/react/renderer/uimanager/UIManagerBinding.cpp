@@ -17,10 +17,45 @@
 #include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
 #include <react/renderer/uimanager/primitives.h>
 
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 
 namespace facebook::react {
 
+enum class UIManagerBinding::Method : uint8_t {
+  CreateNode,
+  SetIsJSResponder,
+  FindNodeAtPoint,
+  CloneNodeWithNewChildren,
+  CloneNodeWithNewProps,
+  CloneNodeWithNewChildrenAndProps,
+  AppendChild,
+  CreateChildSet,
+  AppendChildToSet,
+  ExecuteRenderInstructions,
+  CompleteRoot,
+  RegisterEventHandler,
+  GetRelativeLayoutMetrics,
+  DispatchCommand,
+  SetNativeProps,
+  MeasureLayout,
+  Measure,
+  MeasureInWindow,
+  SendAccessibilityEvent,
+  ConfigureNextLayoutAnimation,
+  UnstableGetCurrentEventPriority,
+  UnstableDefaultEventPriority,
+  UnstableDiscreteEventPriority,
+  UnstableContinuousEventPriority,
+  UnstableIdleEventPriority,
+  FindShadowNodeByTagDeprecated,
+  GetBoundingClientRect,
+  CompareDocumentPosition,
+  Count,
+};
+
 void UIManagerBinding::createAndInstallIfNeeded(
     jsi::Runtime& runtime,
     const std::shared_ptr<UIManager>& uiManager) {
@@ -53,7 +88,8 @@ std::shared_ptr<UIManagerBinding> UIManagerBinding::getBinding(
 }
 
 UIManagerBinding::UIManagerBinding(std::shared_ptr<UIManager> uiManager)
-    : uiManager_(std::move(uiManager)) {}
+    : uiManager_(std::move(uiManager)),
+      hostFunctions_(static_cast<size_t>(Method::Count)) {}
 
 UIManagerBinding::~UIManagerBinding() {
   LOG(WARNING) << "UIManagerBinding::~UIManagerBinding() was called (address: "
@@ -167,8 +203,64 @@ static void validateArgumentCount(
 jsi::Value UIManagerBinding::get(
     jsi::Runtime& runtime,
     const jsi::PropNameID& name) {
+  static const auto methods = std::unordered_map<std::string_view, Method>{
+      {"createNode", Method::CreateNode},
+      {"setIsJSResponder", Method::SetIsJSResponder},
+      {"findNodeAtPoint", Method::FindNodeAtPoint},
+      {"cloneNodeWithNewChildren", Method::CloneNodeWithNewChildren},
+      {"cloneNodeWithNewProps", Method::CloneNodeWithNewProps},
+      {"cloneNodeWithNewChildrenAndProps",
+       Method::CloneNodeWithNewChildrenAndProps},
+      {"appendChild", Method::AppendChild},
+      {"createChildSet", Method::CreateChildSet},
+      {"appendChildToSet", Method::AppendChildToSet},
+      {"executeRenderInstructions", Method::ExecuteRenderInstructions},
+      {"completeRoot", Method::CompleteRoot},
+      {"registerEventHandler", Method::RegisterEventHandler},
+      {"getRelativeLayoutMetrics", Method::GetRelativeLayoutMetrics},
+      {"dispatchCommand", Method::DispatchCommand},
+      {"setNativeProps", Method::SetNativeProps},
+      {"measureLayout", Method::MeasureLayout},
+      {"measure", Method::Measure},
+      {"measureInWindow", Method::MeasureInWindow},
+      {"sendAccessibilityEvent", Method::SendAccessibilityEvent},
+      {"configureNextLayoutAnimation", Method::ConfigureNextLayoutAnimation},
+      {"unstable_getCurrentEventPriority",
+       Method::UnstableGetCurrentEventPriority},
+      {"unstable_DefaultEventPriority", Method::UnstableDefaultEventPriority},
+      {"unstable_DiscreteEventPriority", Method::UnstableDiscreteEventPriority},
+      {"unstable_ContinuousEventPriority",
+       Method::UnstableContinuousEventPriority},
+      {"unstable_IdleEventPriority", Method::UnstableIdleEventPriority},
+      {"findShadowNodeByTag_DEPRECATED", Method::FindShadowNodeByTagDeprecated},
+      {"getBoundingClientRect", Method::GetBoundingClientRect},
+      {"compareDocumentPosition", Method::CompareDocumentPosition},
+  };
+
   auto methodName = name.utf8(runtime);
+  auto iterator = methods.find(methodName);
+  if (iterator == methods.end()) {
+    return jsi::Value::undefined();
+  }
+
+  auto& hostFunction = hostFunctions_[static_cast<size_t>(iterator->second)];
+  if (hostFunction) {
+    return {runtime, *hostFunction};
+  }
+
+  auto value = createMethod(runtime, name, iterator->second, methodName);
+  if (value.isObject()) {
+    hostFunction = std::make_unique<jsi::Function>(
+        value.getObject(runtime).getFunction(runtime));
+  }
+  return value;
+}
 
+jsi::Value UIManagerBinding::createMethod(
+    jsi::Runtime& runtime,
+    const jsi::PropNameID& name,
+    Method method,
+    const std::string& methodName) {
   // Convert shared_ptr<UIManager> to a raw ptr
   // Why? Because:
   // 1) UIManagerBinding strongly retains UIManager. The JS VM
@@ -198,682 +290,830 @@ jsi::Value UIManagerBinding::get(
   //    a CPU tick (or more) after the JS VM is deallocated.
   UIManager* uiManager = uiManager_.get();
 
-  // Semantic: Creates a new node with given pieces.
-  if (methodName == "createNode") {
-    auto paramCount = 5;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          try {
+  switch (method) {
+    // Semantic: Creates a new node with given pieces.
+    case Method::CreateNode: {
+      auto paramCount = 5;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            try {
+              validateArgumentCount(runtime, methodName, paramCount, count);
+
+              auto instanceHandle =
+                  instanceHandleFromValue(runtime, arguments[4], arguments[0]);
+              if (!instanceHandle) {
+                react_native_assert(false);
+                return jsi::Value::undefined();
+              }
+
+              return valueFromShadowNode(
+                  runtime,
+                  uiManager->createNode(
+                      tagFromValue(arguments[0]),
+                      stringFromValue(runtime, arguments[1]),
+                      surfaceIdFromValue(runtime, arguments[2]),
+                      RawProps(runtime, arguments[3]),
+                      std::move(instanceHandle)),
+                  true);
+            } catch (const std::logic_error& ex) {
+              LOG(FATAL) << "logic_error in createNode: " << ex.what();
+            }
+          });
+    }
+
+    case Method::SetIsJSResponder: {
+      auto paramCount = 3;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
             validateArgumentCount(runtime, methodName, paramCount, count);
 
-            auto instanceHandle =
-                instanceHandleFromValue(runtime, arguments[4], arguments[0]);
-            if (!instanceHandle) {
-              react_native_assert(false);
+            uiManager->setIsJSResponder(
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[0]),
+                arguments[1].getBool(),
+                arguments[2].getBool());
+
+            return jsi::Value::undefined();
+          });
+    }
+
+    case Method::FindNodeAtPoint: {
+      auto paramCount = 4;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            auto node = Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                runtime, arguments[0]);
+            auto locationX = (Float)arguments[1].getNumber();
+            auto locationY = (Float)arguments[2].getNumber();
+            auto onSuccessFunction =
+                arguments[3].getObject(runtime).getFunction(runtime);
+            auto targetNode = uiManager->findNodeAtPoint(
+                node, Point{.x = locationX, .y = locationY});
+
+            if (!targetNode) {
+              onSuccessFunction.call(runtime, jsi::Value::null());
               return jsi::Value::undefined();
             }
 
+            auto& eventTarget = targetNode->getEventEmitter()->eventTarget_;
+
+            EventEmitter::DispatchMutex().lock();
+            eventTarget->retain(runtime);
+            auto instanceHandle = eventTarget->getInstanceHandle(runtime);
+            eventTarget->release(runtime);
+            EventEmitter::DispatchMutex().unlock();
+
+            onSuccessFunction.call(runtime, std::move(instanceHandle));
+            return jsi::Value::undefined();
+          });
+    }
+
+    // Semantic: Clones the node with *same* props and *given* children.
+    case Method::CloneNodeWithNewChildren: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            // TODO: re-enable when passChildrenWhenCloningPersistedNodes is
+            // rolled out
+            // validateArgumentCount(runtime, methodName, paramCount, count);
+
             return valueFromShadowNode(
                 runtime,
-                uiManager->createNode(
-                    tagFromValue(arguments[0]),
-                    stringFromValue(runtime, arguments[1]),
-                    surfaceIdFromValue(runtime, arguments[2]),
-                    RawProps(runtime, arguments[3]),
-                    std::move(instanceHandle)),
+                uiManager->cloneNode(
+                    *Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                        runtime, arguments[0]),
+                    count > 1 ? shadowNodeListFromValue(runtime, arguments[1])
+                              : ShadowNode::emptySharedShadowNodeSharedList(),
+                    RawProps()),
                 true);
-          } catch (const std::logic_error& ex) {
-            LOG(FATAL) << "logic_error in createNode: " << ex.what();
-          }
-        });
-  }
+          });
+    }
 
-  if (methodName == "setIsJSResponder") {
-    auto paramCount = 3;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          uiManager->setIsJSResponder(
-              Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                  runtime, arguments[0]),
-              arguments[1].getBool(),
-              arguments[2].getBool());
-
-          return jsi::Value::undefined();
-        });
-  }
+    // Semantic: Clones the node with *given* props and *same* children.
+    case Method::CloneNodeWithNewProps: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
 
-  if (methodName == "findNodeAtPoint") {
-    auto paramCount = 4;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto node = Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-              runtime, arguments[0]);
-          auto locationX = (Float)arguments[1].getNumber();
-          auto locationY = (Float)arguments[2].getNumber();
-          auto onSuccessFunction =
-              arguments[3].getObject(runtime).getFunction(runtime);
-          auto targetNode = uiManager->findNodeAtPoint(
-              node, Point{.x = locationX, .y = locationY});
-
-          if (!targetNode) {
-            onSuccessFunction.call(runtime, jsi::Value::null());
+            return valueFromShadowNode(
+                runtime,
+                uiManager->cloneNode(
+                    *Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                        runtime, arguments[0]),
+                    nullptr,
+                    RawProps(runtime, arguments[1])),
+                true);
+          });
+    }
+
+    // Semantic: Clones the node with *given* props and *given* children.
+    case Method::CloneNodeWithNewChildrenAndProps: {
+      auto paramCount = 3;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            // TODO: re-enable when passChildrenWhenCloningPersistedNodes is
+            // rolled out
+            // validateArgumentCount(runtime, methodName, paramCount, count);
+
+            bool hasChildrenArg = count == 3;
+            return valueFromShadowNode(
+                runtime,
+                uiManager->cloneNode(
+                    *Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                        runtime, arguments[0]),
+                    hasChildrenArg
+                        ? shadowNodeListFromValue(runtime, arguments[1])
+                        : ShadowNode::emptySharedShadowNodeSharedList(),
+                    RawProps(runtime, arguments[hasChildrenArg ? 2 : 1])),
+                true);
+          });
+    }
+
+    case Method::AppendChild: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            uiManager->appendChild(
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[0]),
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[1]));
             return jsi::Value::undefined();
-          }
+          });
+    }
 
-          auto& eventTarget = targetNode->getEventEmitter()->eventTarget_;
+    // TODO: remove when passChildrenWhenCloningPersistedNodes is rolled out
+    case Method::CreateChildSet: {
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [](jsi::Runtime& runtime,
+             const jsi::Value& /*thisValue*/,
+             const jsi::Value* /*arguments*/,
+             size_t /*count*/) -> jsi::Value {
+            auto shadowNodeList = std::make_shared<
+                std::vector<std::shared_ptr<const ShadowNode>>>(
+                std::vector<std::shared_ptr<const ShadowNode>>({}));
+            return valueFromShadowNodeList(runtime, shadowNodeList);
+          });
+    }
 
-          EventEmitter::DispatchMutex().lock();
-          eventTarget->retain(runtime);
-          auto instanceHandle = eventTarget->getInstanceHandle(runtime);
-          eventTarget->release(runtime);
-          EventEmitter::DispatchMutex().unlock();
+    // TODO: remove when passChildrenWhenCloningPersistedNodes is rolled out
+    case Method::AppendChildToSet: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
 
-          onSuccessFunction.call(runtime, std::move(instanceHandle));
-          return jsi::Value::undefined();
-        });
-  }
+            auto shadowNodeList =
+                shadowNodeListFromValue(runtime, arguments[0]);
+            auto shadowNode =
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[1]);
+            shadowNodeList->push_back(shadowNode);
+            return jsi::Value::undefined();
+          });
+    }
 
-  // Semantic: Clones the node with *same* props and *given* children.
-  if (methodName == "cloneNodeWithNewChildren") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          // TODO: re-enable when passChildrenWhenCloningPersistedNodes is
-          // rolled out
-          // validateArgumentCount(runtime, methodName, paramCount, count);
-
-          return valueFromShadowNode(
-              runtime,
-              uiManager->cloneNode(
-                  *Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                      runtime, arguments[0]),
-                  count > 1 ? shadowNodeListFromValue(runtime, arguments[1])
-                            : ShadowNode::emptySharedShadowNodeSharedList(),
-                  RawProps()),
-              true);
-        });
-  }
+    // Semantic: Builds nodes and child sets from a buffer of
+    // `RenderInstruction`s in a single call, instead of one call per
+    // `createNode`, `appendChild`, `createChildSet` and `appendChildToSet`.
+    // Returns the created values in order.
+    case Method::ExecuteRenderInstructions: {
+      auto paramCount = 6;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
 
-  // Semantic: Clones the node with *given* props and *same* children.
-  if (methodName == "cloneNodeWithNewProps") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          return valueFromShadowNode(
-              runtime,
-              uiManager->cloneNode(
-                  *Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                      runtime, arguments[0]),
-                  nullptr,
-                  RawProps(runtime, arguments[1])),
-              true);
-        });
-  }
+            auto surfaceId = surfaceIdFromValue(runtime, arguments[0]);
+
+            // The instructions are copied out of the `ArrayBuffer` because
+            // parsing props may run JavaScript.
+            auto instructionBuffer =
+                arguments[1].asObject(runtime).getArrayBuffer(runtime);
+            auto instructionBufferSize = instructionBuffer.size(runtime);
+            if (instructionBufferSize % sizeof(int32_t) != 0) {
+              throw jsi::JSError(
+                  runtime,
+                  methodName +
+                      ": the length of the instruction buffer must be a "
+                      "multiple of 4, got " +
+                      std::to_string(instructionBufferSize));
+            }
+            auto instructions =
+                std::vector<int32_t>(instructionBufferSize / sizeof(int32_t));
+            std::memcpy(
+                instructions.data(),
+                instructionBuffer.data(runtime),
+                instructionBufferSize);
+
+            size_t nodeCount = 0;
+            try {
+              nodeCount = countCreateNodeRenderInstructions(instructions);
+            } catch (const std::logic_error& ex) {
+              throw jsi::JSError(runtime, methodName + ": " + ex.what());
+            }
 
-  // Semantic: Clones the node with *given* props and *given* children.
-  if (methodName == "cloneNodeWithNewChildrenAndProps") {
-    auto paramCount = 3;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          // TODO: re-enable when passChildrenWhenCloningPersistedNodes is
-          // rolled out
-          // validateArgumentCount(runtime, methodName, paramCount, count);
-
-          bool hasChildrenArg = count == 3;
-          return valueFromShadowNode(
-              runtime,
-              uiManager->cloneNode(
-                  *Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                      runtime, arguments[0]),
-                  hasChildrenArg
-                      ? shadowNodeListFromValue(runtime, arguments[1])
-                      : ShadowNode::emptySharedShadowNodeSharedList(),
-                  RawProps(runtime, arguments[hasChildrenArg ? 2 : 1])),
-              true);
-        });
-  }
+            auto componentNameArray =
+                arguments[2].asObject(runtime).asArray(runtime);
+            auto componentNames = std::vector<std::string>{};
+            componentNames.reserve(componentNameArray.size(runtime));
+            for (size_t i = 0; i < componentNameArray.size(runtime); i++) {
+              componentNames.push_back(stringFromValue(
+                  runtime, componentNameArray.getValueAtIndex(runtime, i)));
+            }
 
-  if (methodName == "appendChild") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          uiManager->appendChild(
-              Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                  runtime, arguments[0]),
-              Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                  runtime, arguments[1]));
-          return jsi::Value::undefined();
-        });
-  }
+            // Every created node takes the next entry of both arrays.
+            auto propsArray = arguments[3].asObject(runtime).asArray(runtime);
+            auto instanceHandleArray =
+                arguments[4].asObject(runtime).asArray(runtime);
+            if (propsArray.size(runtime) != nodeCount ||
+                instanceHandleArray.size(runtime) != nodeCount) {
+              throw jsi::JSError(
+                  runtime,
+                  methodName + ": expected props and instance handles for " +
+                      std::to_string(nodeCount) + " nodes, got " +
+                      std::to_string(propsArray.size(runtime)) + " and " +
+                      std::to_string(instanceHandleArray.size(runtime)));
+            }
 
-  // TODO: remove when passChildrenWhenCloningPersistedNodes is rolled out
-  if (methodName == "createChildSet") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        0,
-        [](jsi::Runtime& runtime,
-           const jsi::Value& /*thisValue*/,
-           const jsi::Value* /*arguments*/,
-           size_t /*count*/) -> jsi::Value {
-          auto shadowNodeList =
-              std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>(
-                  std::vector<std::shared_ptr<const ShadowNode>>({}));
-          return valueFromShadowNodeList(runtime, shadowNodeList);
-        });
-  }
+            auto props = std::vector<RawProps>{};
+            props.reserve(nodeCount);
+            for (size_t i = 0; i < nodeCount; i++) {
+              props.emplace_back(
+                  runtime, propsArray.getValueAtIndex(runtime, i));
+            }
 
-  // TODO: remove when passChildrenWhenCloningPersistedNodes is rolled out
-  if (methodName == "appendChildToSet") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto shadowNodeList = shadowNodeListFromValue(runtime, arguments[0]);
-          auto shadowNode = Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-              runtime, arguments[1]);
-          shadowNodeList->push_back(shadowNode);
-          return jsi::Value::undefined();
-        });
-  }
+            auto createInstanceHandle = [&](size_t index, Tag tag) {
+              return instanceHandleFromValue(
+                  runtime,
+                  instanceHandleArray.getValueAtIndex(runtime, index),
+                  jsi::Value(tag));
+            };
+
+            auto valueArray = arguments[5].asObject(runtime).asArray(runtime);
+            auto values = std::vector<RenderInstructionValue>{};
+            values.reserve(valueArray.size(runtime));
+            for (size_t i = 0; i < valueArray.size(runtime); i++) {
+              auto value = valueArray.getValueAtIndex(runtime, i);
+              auto object = value.asObject(runtime);
+              if (object.hasNativeState<ShadowNodeListWrapper>(runtime)) {
+                values.emplace_back(
+                    object.getNativeState<ShadowNodeListWrapper>(runtime)
+                        ->shadowNodeList);
+              } else {
+                values.emplace_back(
+                    Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                        runtime, value));
+              }
+            }
+            auto passedValueCount = values.size();
+
+            try {
+              uiManager->executeRenderInstructions(
+                  surfaceId,
+                  instructions,
+                  componentNames,
+                  std::move(props),
+                  createInstanceHandle,
+                  values);
+            } catch (const std::logic_error& ex) {
+              throw jsi::JSError(runtime, methodName + ": " + ex.what());
+            }
 
-  if (methodName == "completeRoot") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto runtimeSchedulerBinding =
-              RuntimeSchedulerBinding::getBinding(runtime);
-          auto surfaceId = surfaceIdFromValue(runtime, arguments[0]);
-
-          auto shadowNodeList = shadowNodeListFromValue(runtime, arguments[1]);
-          uiManager->completeSurface(
-              surfaceId,
-              shadowNodeList,
-              {.enableStateReconciliation = true,
-               .mountSynchronously = false,
-               .source = ShadowTree::CommitSource::React});
-
-          return jsi::Value::undefined();
-        });
-  }
+            auto result = jsi::Array(runtime, values.size() - passedValueCount);
+            for (size_t i = passedValueCount; i < values.size(); i++) {
+              if (auto shadowNode =
+                      std::get_if<std::shared_ptr<const ShadowNode>>(
+                          &values[i])) {
+                result.setValueAtIndex(
+                    runtime,
+                    i - passedValueCount,
+                    valueFromShadowNode(runtime, *shadowNode, true));
+              } else {
+                result.setValueAtIndex(
+                    runtime,
+                    i - passedValueCount,
+                    valueFromShadowNodeList(
+                        runtime,
+                        std::get<ShadowNode::UnsharedListOfShared>(values[i])));
+              }
+            }
+            return result;
+          });
+    }
 
-  if (methodName == "registerEventHandler") {
-    auto paramCount = 1;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [this, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto eventHandler =
-              arguments[0].getObject(runtime).getFunction(runtime);
-          eventHandler_ =
-              std::make_unique<jsi::Function>(std::move(eventHandler));
-          return jsi::Value::undefined();
-        });
-  }
+    case Method::CompleteRoot: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
 
-  if (methodName == "getRelativeLayoutMetrics") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
-              *Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                  runtime, arguments[0]),
-              Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                  runtime, arguments[1])
-                  .get(),
-              {/* .includeTransform = */ .includeTransform = false});
-          auto frame = layoutMetrics.frame;
-          auto result = jsi::Object(runtime);
-          result.setProperty(runtime, "left", frame.origin.x);
-          result.setProperty(runtime, "top", frame.origin.y);
-          result.setProperty(runtime, "width", frame.size.width);
-          result.setProperty(runtime, "height", frame.size.height);
-          return result;
-        });
-  }
+            auto runtimeSchedulerBinding =
+                RuntimeSchedulerBinding::getBinding(runtime);
+            auto surfaceId = surfaceIdFromValue(runtime, arguments[0]);
+
+            auto shadowNodeList =
+                shadowNodeListFromValue(runtime, arguments[1]);
+            uiManager->completeSurface(
+                surfaceId,
+                shadowNodeList,
+                {.enableStateReconciliation = true,
+                 .mountSynchronously = false,
+                 .source = ShadowTree::CommitSource::React});
+
+            return jsi::Value::undefined();
+          });
+    }
+
+    case Method::RegisterEventHandler: {
+      auto paramCount = 1;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [this, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            auto eventHandler =
+                arguments[0].getObject(runtime).getFunction(runtime);
+            eventHandler_ =
+                std::make_unique<jsi::Function>(std::move(eventHandler));
+            return jsi::Value::undefined();
+          });
+    }
+
+    case Method::GetRelativeLayoutMetrics: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
+                *Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[0]),
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[1])
+                    .get(),
+                {/* .includeTransform = */ .includeTransform = false});
+            auto frame = layoutMetrics.frame;
+            auto result = jsi::Object(runtime);
+            result.setProperty(runtime, "left", frame.origin.x);
+            result.setProperty(runtime, "top", frame.origin.y);
+            result.setProperty(runtime, "width", frame.size.width);
+            result.setProperty(runtime, "height", frame.size.height);
+            return result;
+          });
+    }
+
+    case Method::DispatchCommand: {
+      auto paramCount = 3;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            if (arguments[0].isObject()) {
+              auto shadowNode =
+                  Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                      runtime, arguments[0]);
+              uiManager->dispatchCommand(
+                  shadowNode,
+                  stringFromValue(runtime, arguments[1]),
+                  commandArgsFromValue(runtime, arguments[2]));
+            }
+            return jsi::Value::undefined();
+          });
+    }
+
+    case Method::SetNativeProps: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value&,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            uiManager->setNativeProps_DEPRECATED(
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[0]),
+                RawProps(runtime, arguments[1]));
+
+            return jsi::Value::undefined();
+          });
+    }
+
+    // Legacy API
+    case Method::MeasureLayout: {
+      auto paramCount = 4;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) {
+            validateArgumentCount(runtime, methodName, paramCount, count);
 
-  if (methodName == "dispatchCommand") {
-    auto paramCount = 3;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          if (arguments[0].isObject()) {
             auto shadowNode =
                 Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
                     runtime, arguments[0]);
-            uiManager->dispatchCommand(
-                shadowNode,
-                stringFromValue(runtime, arguments[1]),
-                commandArgsFromValue(runtime, arguments[2]));
-          }
-          return jsi::Value::undefined();
-        });
-  }
+            auto relativeToShadowNode =
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[1]);
+            auto onFailFunction =
+                arguments[2].getObject(runtime).getFunction(runtime);
+            auto onSuccessFunction =
+                arguments[3].getObject(runtime).getFunction(runtime);
+
+            auto currentRevision =
+                uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
+                    shadowNode->getSurfaceId());
+            if (currentRevision == nullptr) {
+              onFailFunction.call(runtime);
+              return jsi::Value::undefined();
+            }
 
-  if (methodName == "setNativeProps") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value&,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          uiManager->setNativeProps_DEPRECATED(
-              Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                  runtime, arguments[0]),
-              RawProps(runtime, arguments[1]));
-
-          return jsi::Value::undefined();
-        });
-  }
+            auto maybeRect = dom::measureLayout(
+                currentRevision, *shadowNode, *relativeToShadowNode);
 
-  // Legacy API
-  if (methodName == "measureLayout") {
-    auto paramCount = 4;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto shadowNode = Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-              runtime, arguments[0]);
-          auto relativeToShadowNode =
-              Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                  runtime, arguments[1]);
-          auto onFailFunction =
-              arguments[2].getObject(runtime).getFunction(runtime);
-          auto onSuccessFunction =
-              arguments[3].getObject(runtime).getFunction(runtime);
-
-          auto currentRevision =
-              uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
-                  shadowNode->getSurfaceId());
-          if (currentRevision == nullptr) {
-            onFailFunction.call(runtime);
+            if (!maybeRect) {
+              onFailFunction.call(runtime);
+              return jsi::Value::undefined();
+            }
+
+            auto rect = maybeRect.value();
+
+            onSuccessFunction.call(
+                runtime,
+                {jsi::Value{runtime, rect.x},
+                 jsi::Value{runtime, rect.y},
+                 jsi::Value{runtime, rect.width},
+                 jsi::Value{runtime, rect.height}});
             return jsi::Value::undefined();
-          }
+          });
+    }
 
-          auto maybeRect = dom::measureLayout(
-              currentRevision, *shadowNode, *relativeToShadowNode);
+    case Method::Measure: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) {
+            validateArgumentCount(runtime, methodName, paramCount, count);
 
-          if (!maybeRect) {
-            onFailFunction.call(runtime);
+            auto shadowNode =
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[0]);
+            auto callbackFunction =
+                arguments[1].getObject(runtime).getFunction(runtime);
+
+            auto currentRevision =
+                uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
+                    shadowNode->getSurfaceId());
+            if (currentRevision == nullptr) {
+              callbackFunction.call(runtime, {0, 0, 0, 0, 0, 0});
+              return jsi::Value::undefined();
+            }
+
+            auto measureRect = dom::measure(currentRevision, *shadowNode);
+
+            callbackFunction.call(
+                runtime,
+                {jsi::Value{runtime, measureRect.x},
+                 jsi::Value{runtime, measureRect.y},
+                 jsi::Value{runtime, measureRect.width},
+                 jsi::Value{runtime, measureRect.height},
+                 jsi::Value{runtime, measureRect.pageX},
+                 jsi::Value{runtime, measureRect.pageY}});
             return jsi::Value::undefined();
-          }
-
-          auto rect = maybeRect.value();
-
-          onSuccessFunction.call(
-              runtime,
-              {jsi::Value{runtime, rect.x},
-               jsi::Value{runtime, rect.y},
-               jsi::Value{runtime, rect.width},
-               jsi::Value{runtime, rect.height}});
-          return jsi::Value::undefined();
-        });
-  }
+          });
+    }
 
-  if (methodName == "measure") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto shadowNode = Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-              runtime, arguments[0]);
-          auto callbackFunction =
-              arguments[1].getObject(runtime).getFunction(runtime);
-
-          auto currentRevision =
-              uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
-                  shadowNode->getSurfaceId());
-          if (currentRevision == nullptr) {
-            callbackFunction.call(runtime, {0, 0, 0, 0, 0, 0});
+    case Method::MeasureInWindow: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            auto shadowNode =
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[0]);
+            auto callbackFunction =
+                arguments[1].getObject(runtime).getFunction(runtime);
+
+            auto currentRevision =
+                uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
+                    shadowNode->getSurfaceId());
+
+            if (currentRevision == nullptr) {
+              callbackFunction.call(runtime, {0, 0, 0, 0});
+              return jsi::Value::undefined();
+            }
+
+            auto rect = dom::measureInWindow(currentRevision, *shadowNode);
+            callbackFunction.call(
+                runtime,
+                {jsi::Value{runtime, rect.x},
+                 jsi::Value{runtime, rect.y},
+                 jsi::Value{runtime, rect.width},
+                 jsi::Value{runtime, rect.height}});
             return jsi::Value::undefined();
-          }
-
-          auto measureRect = dom::measure(currentRevision, *shadowNode);
-
-          callbackFunction.call(
-              runtime,
-              {jsi::Value{runtime, measureRect.x},
-               jsi::Value{runtime, measureRect.y},
-               jsi::Value{runtime, measureRect.width},
-               jsi::Value{runtime, measureRect.height},
-               jsi::Value{runtime, measureRect.pageX},
-               jsi::Value{runtime, measureRect.pageY}});
-          return jsi::Value::undefined();
-        });
-  }
+          });
+    }
+
+    case Method::SendAccessibilityEvent: {
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            uiManager->sendAccessibilityEvent(
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[0]),
+                stringFromValue(runtime, arguments[1]));
 
-  if (methodName == "measureInWindow") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto shadowNode = Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-              runtime, arguments[0]);
-          auto callbackFunction =
-              arguments[1].getObject(runtime).getFunction(runtime);
-
-          auto currentRevision =
-              uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
-                  shadowNode->getSurfaceId());
-
-          if (currentRevision == nullptr) {
-            callbackFunction.call(runtime, {0, 0, 0, 0});
             return jsi::Value::undefined();
-          }
-
-          auto rect = dom::measureInWindow(currentRevision, *shadowNode);
-          callbackFunction.call(
-              runtime,
-              {jsi::Value{runtime, rect.x},
-               jsi::Value{runtime, rect.y},
-               jsi::Value{runtime, rect.width},
-               jsi::Value{runtime, rect.height}});
-          return jsi::Value::undefined();
-        });
-  }
+          });
+    }
 
-  if (methodName == "sendAccessibilityEvent") {
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          uiManager->sendAccessibilityEvent(
-              Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                  runtime, arguments[0]),
-              stringFromValue(runtime, arguments[1]));
-
-          return jsi::Value::undefined();
-        });
-  }
+    case Method::ConfigureNextLayoutAnimation: {
+      auto paramCount = 3;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
 
-  if (methodName == "configureNextLayoutAnimation") {
-    auto paramCount = 3;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          uiManager->configureNextLayoutAnimation(
-              runtime,
-              // TODO: pass in JSI value instead of folly::dynamic to RawValue
-              RawValue(commandArgsFromValue(runtime, arguments[0])),
-              arguments[1],
-              arguments[2]);
-          return jsi::Value::undefined();
-        });
-  }
+            uiManager->configureNextLayoutAnimation(
+                runtime,
+                // TODO: pass in JSI value instead of folly::dynamic to RawValue
+                RawValue(commandArgsFromValue(runtime, arguments[0])),
+                arguments[1],
+                arguments[2]);
+            return jsi::Value::undefined();
+          });
+    }
 
-  if (methodName == "unstable_getCurrentEventPriority") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        0,
-        [this](
-            jsi::Runtime& /*runtime*/,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* /*arguments*/,
-            size_t /*count*/) -> jsi::Value {
-          return {serialize(currentEventPriority_)};
-        });
-  }
+    case Method::UnstableGetCurrentEventPriority: {
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [this](
+              jsi::Runtime& /*runtime*/,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* /*arguments*/,
+              size_t /*count*/) -> jsi::Value {
+            return {serialize(currentEventPriority_)};
+          });
+    }
 
-  if (methodName == "unstable_DefaultEventPriority") {
-    return {serialize(ReactEventPriority::Default)};
-  }
+    case Method::UnstableDefaultEventPriority: {
+      return {serialize(ReactEventPriority::Default)};
+    }
 
-  if (methodName == "unstable_DiscreteEventPriority") {
-    return {serialize(ReactEventPriority::Discrete)};
-  }
+    case Method::UnstableDiscreteEventPriority: {
+      return {serialize(ReactEventPriority::Discrete)};
+    }
 
-  if (methodName == "unstable_ContinuousEventPriority") {
-    return {serialize(ReactEventPriority::Continuous)};
-  }
+    case Method::UnstableContinuousEventPriority: {
+      return {serialize(ReactEventPriority::Continuous)};
+    }
 
-  if (methodName == "unstable_IdleEventPriority") {
-    return {serialize(ReactEventPriority::Idle)};
-  }
+    case Method::UnstableIdleEventPriority: {
+      return {serialize(ReactEventPriority::Idle)};
+    }
 
-  if (methodName == "findShadowNodeByTag_DEPRECATED") {
-    auto paramCount = 1;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value&,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto shadowNode = uiManager->findShadowNodeByTag_DEPRECATED(
-              tagFromValue(arguments[0]));
-
-          if (!shadowNode) {
-            return jsi::Value::null();
-          }
-
-          return valueFromShadowNode(runtime, shadowNode);
-        });
-  }
+    case Method::FindShadowNodeByTagDeprecated: {
+      auto paramCount = 1;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value&,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
 
-  if (methodName == "getBoundingClientRect") {
-    // This has been moved to `NativeDOM` but we need to keep it here because
-    // there are still some callsites using this method in apps that don't have
-    // the DOM APIs enabled yet.
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto shadowNode = Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-              runtime, arguments[0]);
-          bool includeTransform = arguments[1].getBool();
-
-          auto currentRevision =
-              uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
-                  shadowNode->getSurfaceId());
-
-          if (currentRevision == nullptr) {
-            return jsi::Value::undefined();
-          }
-
-          auto domRect = dom::getBoundingClientRect(
-              currentRevision, *shadowNode, includeTransform);
-
-          return jsi::Array::createWithElements(
-              runtime,
-              jsi::Value{runtime, domRect.x},
-              jsi::Value{runtime, domRect.y},
-              jsi::Value{runtime, domRect.width},
-              jsi::Value{runtime, domRect.height});
-        });
-  }
+            auto shadowNode = uiManager->findShadowNodeByTag_DEPRECATED(
+                tagFromValue(arguments[0]));
 
-  if (methodName == "compareDocumentPosition") {
-    // This has been moved to `NativeDOM` but we need to keep it here because
-    // there are still some callsites using this method in apps that don't have
-    // the DOM APIs enabled yet.
-    auto paramCount = 2;
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        paramCount,
-        [uiManager, methodName, paramCount](
-            jsi::Runtime& runtime,
-            const jsi::Value& /*thisValue*/,
-            const jsi::Value* arguments,
-            size_t count) -> jsi::Value {
-          validateArgumentCount(runtime, methodName, paramCount, count);
-
-          auto shadowNode = Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-              runtime, arguments[0]);
-          auto otherShadowNode =
-              Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
-                  runtime, arguments[1]);
-
-          auto currentRevision =
-              uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
-                  shadowNode->getSurfaceId());
-
-          double documentPosition = 0;
-
-          if (currentRevision != nullptr) {
-            documentPosition = (double)dom::compareDocumentPosition(
-                currentRevision, *shadowNode, *otherShadowNode);
-          }
-
-          return {documentPosition};
-        });
+            if (!shadowNode) {
+              return jsi::Value::null();
+            }
+
+            return valueFromShadowNode(runtime, shadowNode);
+          });
+    }
+
+    case Method::GetBoundingClientRect: {
+      // This has been moved to `NativeDOM` but we need to keep it here
+      // because there are still some callsites using this method in apps that
+      // don't have the DOM APIs enabled yet.
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            auto shadowNode =
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[0]);
+            bool includeTransform = arguments[1].getBool();
+
+            auto currentRevision =
+                uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
+                    shadowNode->getSurfaceId());
+
+            if (currentRevision == nullptr) {
+              return jsi::Value::undefined();
+            }
+
+            auto domRect = dom::getBoundingClientRect(
+                currentRevision, *shadowNode, includeTransform);
+
+            return jsi::Array::createWithElements(
+                runtime,
+                jsi::Value{runtime, domRect.x},
+                jsi::Value{runtime, domRect.y},
+                jsi::Value{runtime, domRect.width},
+                jsi::Value{runtime, domRect.height});
+          });
+    }
+
+    case Method::CompareDocumentPosition: {
+      // This has been moved to `NativeDOM` but we need to keep it here
+      // because there are still some callsites using this method in apps that
+      // don't have the DOM APIs enabled yet.
+      auto paramCount = 2;
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          paramCount,
+          [uiManager, methodName, paramCount](
+              jsi::Runtime& runtime,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* arguments,
+              size_t count) -> jsi::Value {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            auto shadowNode =
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[0]);
+            auto otherShadowNode =
+                Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+                    runtime, arguments[1]);
+
+            auto currentRevision =
+                uiManager->getShadowTreeRevisionProvider()->getCurrentRevision(
+                    shadowNode->getSurfaceId());
+
+            double documentPosition = 0;
+
+            if (currentRevision != nullptr) {
+              documentPosition = (double)dom::compareDocumentPosition(
+                  currentRevision, *shadowNode, *otherShadowNode);
+            }
+
+            return {documentPosition};
+          });
+    }
+
+    case Method::Count:
+      break;
   }
 
   return jsi::Value::undefined();
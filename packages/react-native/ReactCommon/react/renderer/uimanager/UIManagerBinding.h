@@ -67,6 +67,17 @@ class UIManagerBinding : public jsi::HostObject {
   PointerEventsProcessor &getPointerEventsProcessor();
 
  private:
+  enum class Method : uint8_t;
+
+  /*
+   * Creates the value of the given `nativeFabricUIManager` method.
+   */
+  jsi::Value createMethod(
+      jsi::Runtime &runtime,
+      const jsi::PropNameID &name,
+      Method method,
+      const std::string &methodName);
+
   /*
    * Internal method that sends the event to JS. Should only be called from
    * UIManagerBinding::dispatchEvent.
@@ -80,6 +91,13 @@ class UIManagerBinding : public jsi::HostObject {
 
   std::shared_ptr<UIManager> uiManager_;
   std::unique_ptr<jsi::Function> eventHandler_;
+
+  /*
+   * Host functions returned by `get`, indexed by `Method`.
+   * The binding is installed into a single runtime, so each of them is
+   * created once and then shared by all lookups of the same method.
+   */
+  std::vector<std::unique_ptr<jsi::Function>> hostFunctions_;
   mutable PointerEventsProcessor pointerEventsProcessor_;
   mutable ReactEventPriority currentEventPriority_;
 };
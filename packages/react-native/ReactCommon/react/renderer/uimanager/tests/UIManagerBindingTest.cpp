@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/bridging/bridging.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerBinding.h>
+#include <react/utils/ContextContainer.h>
+
+namespace facebook::react {
+
+class UIManagerBindingTest : public ::testing::Test {
+ protected:
+  UIManagerBindingTest() : runtime_(facebook::hermes::makeHermesRuntime()) {
+    auto contextContainer = std::make_shared<ContextContainer>();
+
+    ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+    auto componentDescriptorRegistry =
+        componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{
+                .eventDispatcher = EventDispatcher::Shared{},
+                .contextContainer = contextContainer,
+                .flavor = nullptr});
+    componentDescriptorProviderRegistry.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    uiManager_ = std::make_shared<UIManager>(
+        [](std::function<void(jsi::Runtime & runtime)>&& /*callback*/) {},
+        contextContainer);
+    uiManager_->setComponentDescriptorRegistry(componentDescriptorRegistry);
+
+    UIManagerBinding::createAndInstallIfNeeded(*runtime_, uiManager_);
+  }
+
+  jsi::Value evaluate(std::string source) {
+    return runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(std::move(source)), "");
+  }
+
+  // Calls `executeRenderInstructions` with the given instruction buffer, props
+  // and instance handles, creating all nodes as Views on surface 1.
+  jsi::Value executeRenderInstructions(
+      const std::string& instructionBuffer,
+      const std::string& props,
+      const std::string& instanceHandles) {
+    return evaluate(
+        "nativeFabricUIManager.executeRenderInstructions(1, " +
+        instructionBuffer + ", ['View'], " + props + ", " + instanceHandles +
+        ", [])");
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::shared_ptr<UIManager> uiManager_;
+};
+
+TEST_F(UIManagerBindingTest, executeRenderInstructionsCreatesNodes) {
+  // CreateNode(2, View), CreateNode(3, View), AppendChild(0, 1)
+  auto result = executeRenderInstructions(
+      "new Int32Array([0, 2, 0, 0, 3, 0, 1, 0, 1]).buffer",
+      "[{nativeID: 'parent'}, {nativeID: 'child'}]",
+      "[{}, {}]");
+
+  auto nodes = result.asObject(*runtime_).asArray(*runtime_);
+  ASSERT_EQ(nodes.size(*runtime_), 2);
+
+  auto parentShadowNode = Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+      *runtime_, nodes.getValueAtIndex(*runtime_, 0));
+  EXPECT_EQ(parentShadowNode->getTag(), 2);
+  ASSERT_EQ(parentShadowNode->getChildren().size(), 1);
+  EXPECT_EQ(parentShadowNode->getChildren()[0]->getTag(), 3);
+}
+
+TEST_F(UIManagerBindingTest, executeRenderInstructionsRejectsMisalignedBuffer) {
+  EXPECT_THROW(
+      executeRenderInstructions("new ArrayBuffer(6)", "[]", "[]"),
+      jsi::JSError);
+}
+
+TEST_F(UIManagerBindingTest, executeRenderInstructionsRejectsTruncatedBuffer) {
+  EXPECT_THROW(
+      executeRenderInstructions(
+          "new Int32Array([0, 2]).buffer", "[{}]", "[{}]"),
+      jsi::JSError);
+}
+
+TEST_F(
+    UIManagerBindingTest,
+    executeRenderInstructionsRejectsMissingInstanceHandles) {
+  EXPECT_THROW(
+      executeRenderInstructions(
+          "new Int32Array([0, 2, 0, 0, 3, 0]).buffer", "[{}, {}]", "[{}]"),
+      jsi::JSError);
+}
+
+TEST_F(UIManagerBindingTest, executeRenderInstructionsRejectsMissingProps) {
+  EXPECT_THROW(
+      executeRenderInstructions(
+          "new Int32Array([0, 2, 0, 0, 3, 0]).buffer", "[{}]", "[{}, {}]"),
+      jsi::JSError);
+}
+
+} // namespace facebook::react
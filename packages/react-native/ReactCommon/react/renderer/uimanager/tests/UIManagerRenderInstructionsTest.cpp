@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/uimanager/UIManager.h>
+
+namespace facebook::react {
+
+namespace {
+
+std::vector<int32_t> makeInstructions(
+    std::initializer_list<std::initializer_list<int32_t>> instructions) {
+  auto result = std::vector<int32_t>{};
+  for (const auto& instruction : instructions) {
+    result.insert(result.end(), instruction.begin(), instruction.end());
+  }
+  return result;
+}
+
+int32_t opcode(RenderInstruction instruction) {
+  return static_cast<int32_t>(instruction);
+}
+
+void expectEqualTrees(const ShadowNode& lhs, const ShadowNode& rhs) {
+  EXPECT_EQ(lhs.getTag(), rhs.getTag());
+  EXPECT_EQ(lhs.getSurfaceId(), rhs.getSurfaceId());
+  EXPECT_EQ(lhs.getComponentHandle(), rhs.getComponentHandle());
+
+  const auto& lhsProps = static_cast<const ViewProps&>(*lhs.getProps());
+  const auto& rhsProps = static_cast<const ViewProps&>(*rhs.getProps());
+  EXPECT_EQ(lhsProps.nativeId, rhsProps.nativeId);
+  EXPECT_EQ(lhsProps.opacity, rhsProps.opacity);
+  EXPECT_EQ(lhsProps.yogaStyle, rhsProps.yogaStyle);
+
+  ASSERT_EQ(lhs.getChildren().size(), rhs.getChildren().size());
+  for (size_t i = 0; i < lhs.getChildren().size(); i++) {
+    expectEqualTrees(*lhs.getChildren()[i], *rhs.getChildren()[i]);
+  }
+}
+
+} // namespace
+
+class UIManagerRenderInstructionsTest : public ::testing::Test {
+ protected:
+  UIManagerRenderInstructionsTest() {
+    auto contextContainer = std::make_shared<ContextContainer>();
+
+    ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+    auto componentDescriptorRegistry =
+        componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{
+                .eventDispatcher = EventDispatcher::Shared{},
+                .contextContainer = contextContainer,
+                .flavor = nullptr});
+    componentDescriptorProviderRegistry.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    uiManager_ = std::make_unique<UIManager>(
+        [](std::function<void(jsi::Runtime & runtime)>&& /*callback*/) {},
+        contextContainer);
+    uiManager_->setComponentDescriptorRegistry(componentDescriptorRegistry);
+  }
+
+  static RawProps propsForTag(Tag tag) {
+    return RawProps(folly::dynamic::object("nativeID", std::to_string(tag))(
+        "opacity", 1.0 / tag)("width", tag * 10));
+  }
+
+  void executeRenderInstructions(
+      const std::vector<int32_t>& instructions,
+      const std::vector<Tag>& createdTags,
+      std::vector<RenderInstructionValue>& values) {
+    auto props = std::vector<RawProps>{};
+    for (auto tag : createdTags) {
+      props.push_back(propsForTag(tag));
+    }
+    uiManager_->executeRenderInstructions(
+        kSurfaceId,
+        instructions,
+        {"View"},
+        std::move(props),
+        [&](size_t index, Tag tag) {
+          EXPECT_EQ(tag, createdTags.at(index));
+          return InstanceHandle::Shared{};
+        },
+        values);
+  }
+
+  std::shared_ptr<const ShadowNode> createNode(Tag tag) {
+    return uiManager_->createNode(
+        tag, "View", kSurfaceId, propsForTag(tag), nullptr);
+  }
+
+  static constexpr SurfaceId kSurfaceId = 1;
+  std::unique_ptr<UIManager> uiManager_;
+};
+
+TEST_F(UIManagerRenderInstructionsTest, buildsSameTreeAsSeparateCalls) {
+  /*
+   * <View 2>
+   *   <View 3>
+   *     <View 4 />
+   *   </View>
+   *   <View 5 />
+   * </View>
+   * <View 6 />
+   */
+  auto node2 = createNode(2);
+  auto node3 = createNode(3);
+  auto node4 = createNode(4);
+  uiManager_->appendChild(node3, node4);
+  uiManager_->appendChild(node2, node3);
+  auto node5 = createNode(5);
+  uiManager_->appendChild(node2, node5);
+  auto node6 = createNode(6);
+  auto childSet =
+      std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>();
+  childSet->push_back(node2);
+  childSet->push_back(node6);
+
+  auto values = std::vector<RenderInstructionValue>{};
+  executeRenderInstructions(
+      makeInstructions({
+          {opcode(RenderInstruction::CreateNode), 2, 0}, // 0
+          {opcode(RenderInstruction::CreateNode), 3, 0}, // 1
+          {opcode(RenderInstruction::CreateNode), 4, 0}, // 2
+          {opcode(RenderInstruction::AppendChild), 1, 2},
+          {opcode(RenderInstruction::AppendChild), 0, 1},
+          {opcode(RenderInstruction::CreateNode), 5, 0}, // 3
+          {opcode(RenderInstruction::AppendChild), 0, 3},
+          {opcode(RenderInstruction::CreateNode), 6, 0}, // 4
+          {opcode(RenderInstruction::CreateChildSet)}, // 5
+          {opcode(RenderInstruction::AppendChildToSet), 5, 0},
+          {opcode(RenderInstruction::AppendChildToSet), 5, 4},
+      }),
+      {2, 3, 4, 5, 6},
+      values);
+
+  ASSERT_EQ(values.size(), 6);
+  auto batchedChildSet =
+      std::get<ShadowNode::UnsharedListOfShared>(values.back());
+  ASSERT_EQ(batchedChildSet->size(), childSet->size());
+  for (size_t i = 0; i < childSet->size(); i++) {
+    expectEqualTrees(*childSet->at(i), *batchedChildSet->at(i));
+  }
+}
+
+TEST_F(UIManagerRenderInstructionsTest, operatesOnPassedValues) {
+  auto existingNode = createNode(2);
+  auto existingChildSet =
+      std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>();
+
+  auto values = std::vector<RenderInstructionValue>{
+      existingNode, existingChildSet};
+  executeRenderInstructions(
+      makeInstructions({
+          {opcode(RenderInstruction::CreateNode), 3, 0}, // 2
+          {opcode(RenderInstruction::AppendChild), 2, 0},
+          {opcode(RenderInstruction::AppendChildToSet), 1, 2},
+      }),
+      {3},
+      values);
+
+  ASSERT_EQ(values.size(), 3);
+  auto createdNode = std::get<std::shared_ptr<const ShadowNode>>(values[2]);
+  ASSERT_EQ(createdNode->getChildren().size(), 1);
+  EXPECT_EQ(createdNode->getChildren()[0], existingNode);
+  ASSERT_EQ(existingChildSet->size(), 1);
+  EXPECT_EQ(existingChildSet->at(0), createdNode);
+}
+
+TEST_F(UIManagerRenderInstructionsTest, rejectsMalformedInstructions) {
+  auto values = std::vector<RenderInstructionValue>{};
+  EXPECT_THROW(
+      executeRenderInstructions(
+          {opcode(RenderInstruction::CreateNode), 2}, {2}, values),
+      std::logic_error);
+  EXPECT_THROW(executeRenderInstructions({42}, {}, values), std::logic_error);
+  EXPECT_THROW(
+      executeRenderInstructions(
+          makeInstructions({
+              {opcode(RenderInstruction::CreateChildSet)},
+              {opcode(RenderInstruction::AppendChild), 0, 0},
+          }),
+          {},
+          values),
+      std::logic_error);
+  EXPECT_THROW(
+      executeRenderInstructions(
+          {opcode(RenderInstruction::AppendChildToSet), 7, 0}, {}, values),
+      std::logic_error);
+}
+
+TEST(RenderInstructionTest, countsCreateNodeInstructions) {
+  EXPECT_EQ(countCreateNodeRenderInstructions({}), 0);
+  EXPECT_EQ(
+      countCreateNodeRenderInstructions(makeInstructions({
+          {opcode(RenderInstruction::CreateNode), 2, 0},
+          {opcode(RenderInstruction::CreateChildSet)},
+          {opcode(RenderInstruction::CreateNode), 3, 0},
+          {opcode(RenderInstruction::AppendChild), 0, 2},
+          {opcode(RenderInstruction::AppendChildToSet), 1, 0},
+      })),
+      2);
+  EXPECT_THROW(
+      countCreateNodeRenderInstructions(
+          makeInstructions({{opcode(RenderInstruction::CreateNode), 2}})),
+      std::logic_error);
+  EXPECT_THROW(
+      countCreateNodeRenderInstructions(makeInstructions({{42}})),
+      std::logic_error);
+}
+
+} // namespace facebook::react
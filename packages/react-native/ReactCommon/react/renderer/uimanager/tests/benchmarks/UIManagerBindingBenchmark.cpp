@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerBinding.h>
+#include <react/utils/ContextContainer.h>
+
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+// Methods looked up by the renderer while rendering and committing a
+// typical update, in the proportions they are usually called.
+const auto kRenderPhaseMethodNames = std::vector<const char*>{
+    "createNode",
+    "createNode",
+    "createNode",
+    "cloneNodeWithNewProps",
+    "cloneNodeWithNewProps",
+    "cloneNodeWithNewChildren",
+    "appendChild",
+    "appendChild",
+    "createChildSet",
+    "appendChildToSet",
+    "appendChildToSet",
+    "completeRoot",
+};
+
+struct UIManagerBindingFixture {
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime;
+  std::shared_ptr<UIManager> uiManager;
+  std::shared_ptr<UIManagerBinding> uiManagerBinding;
+  std::vector<jsi::PropNameID> methodNames;
+
+  UIManagerBindingFixture() {
+    runtime = facebook::hermes::makeHermesRuntime();
+    uiManager = std::make_shared<UIManager>(
+        [](std::function<void(jsi::Runtime&)>&& /*callback*/) {},
+        std::make_shared<ContextContainer>());
+    UIManagerBinding::createAndInstallIfNeeded(*runtime, uiManager);
+    uiManagerBinding = UIManagerBinding::getBinding(*runtime);
+
+    for (const auto* methodName : kRenderPhaseMethodNames) {
+      methodNames.push_back(jsi::PropNameID::forAscii(*runtime, methodName));
+    }
+  }
+
+  ~UIManagerBindingFixture() {
+    methodNames.clear();
+    uiManagerBinding = nullptr;
+    runtime = nullptr;
+  }
+};
+
+} // namespace
+
+static void getRenderPhaseMethods(benchmark::State& state) {
+  auto fixture = UIManagerBindingFixture{};
+  auto& runtime = *fixture.runtime;
+
+  for (auto _ : state) {
+    for (const auto& methodName : fixture.methodNames) {
+      benchmark::DoNotOptimize(
+          fixture.uiManagerBinding->get(runtime, methodName));
+    }
+  }
+
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<int64_t>(fixture.methodNames.size()));
+}
+BENCHMARK(getRenderPhaseMethods);
+
+static void getRenderPhaseMethodsFromJavaScript(benchmark::State& state) {
+  auto fixture = UIManagerBindingFixture{};
+  auto& runtime = *fixture.runtime;
+
+  auto source = std::string{
+      "(function(iterations) {"
+      "  var uiManager = nativeFabricUIManager;"
+      "  var method;"
+      "  for (var i = 0; i < iterations; i++) {"};
+  for (const auto* methodName : kRenderPhaseMethodNames) {
+    source += "method = uiManager." + std::string{methodName} + ";";
+  }
+  source += "  }  return method;})";
+
+  auto function =
+      runtime
+          .evaluateJavaScript(
+              std::make_shared<jsi::StringBuffer>(std::move(source)), "")
+          .asObject(runtime)
+          .asFunction(runtime);
+
+  constexpr auto kIterations = 100;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(function.call(runtime, kIterations));
+  }
+
+  state.SetItemsProcessed(
+      state.iterations() * kIterations *
+      static_cast<int64_t>(kRenderPhaseMethodNames.size()));
+}
+BENCHMARK(getRenderPhaseMethodsFromJavaScript);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerCommitHook.h>
+#include <react/utils/ContextContainer.h>
+#include <react/utils/Telemetry.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Every benchmark drives `surfaces` surfaces from `threads` threads. Each
+ * thread alternates between a state update of the scroll view of a surface
+ * and a JavaScript commit of the whole surface, moving on to the next surface
+ * after every commit, and mounts the surface right after committing to it.
+ * Commits go through `ShadowTreeRegistry::visit` and `ShadowTree::commit` the
+ * same way `UIManager` does, so their status can be observed.
+ * `recursive` selects the commit lock of `ShadowTree` through
+ * `preventShadowTreeCommitExhaustion`.
+ *
+ * Reported counters:
+ * - commits: successful commits per second;
+ * - retries: failed `tryCommit` attempts per successful commit;
+ * - commitUs: time spent in `ShadowTree::commit` per successful commit, in
+ *   microseconds, including failed attempts and the wait for the recursive
+ *   commit lock;
+ * - commitLockWaitUs: time the successful attempt spent acquiring the commit
+ *   lock, in microseconds, read from the telemetry of the mounted
+ *   transactions;
+ * - registryLockWaitUs: time spent waiting for the `ShadowTreeRegistry` lock
+ *   per successful commit, in microseconds.
+ */
+
+namespace {
+
+constexpr auto kCommitsPerThread = 100;
+constexpr auto kViewsPerSurface = 20;
+
+class CommitBenchmarkFeatureFlags : public ReactNativeFeatureFlagsDefaults {
+ public:
+  explicit CommitBenchmarkFeatureFlags(bool preventShadowTreeCommitExhaustion)
+      : preventShadowTreeCommitExhaustion_(preventShadowTreeCommitExhaustion) {
+  }
+
+  bool preventShadowTreeCommitExhaustion() override {
+    return preventShadowTreeCommitExhaustion_;
+  }
+
+ private:
+  bool preventShadowTreeCommitExhaustion_;
+};
+
+/*
+ * Commit hooks run once per `tryCommit` attempt, so counting their calls
+ * gives the number of attempts.
+ */
+class CommitAttemptCounter : public UIManagerCommitHook {
+ public:
+  void commitHookWasRegistered(const UIManager& /*uiManager*/) noexcept
+      override {}
+
+  void commitHookWasUnregistered(const UIManager& /*uiManager*/) noexcept
+      override {}
+
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTreeCommitOptions& /*commitOptions*/) noexcept override {
+    attempts.fetch_add(1, std::memory_order_relaxed);
+    return newRootShadowNode;
+  }
+
+  std::atomic<int64_t> attempts{0};
+};
+
+struct Surface {
+  SurfaceId surfaceId;
+  std::shared_ptr<const ShadowNode> scrollViewShadowNode;
+  std::vector<std::shared_ptr<const ShadowNode>> viewShadowNodes;
+};
+
+struct CommitStatistics {
+  int64_t commits{0};
+  int64_t mountedTransactions{0};
+  TelemetryDuration commitTime{0};
+  TelemetryDuration commitLockWaitTime{0};
+  TelemetryDuration registryLockWaitTime{0};
+};
+
+struct UIManagerCommitFixture {
+  std::shared_ptr<ContextContainer> contextContainer;
+  std::unique_ptr<UIManager> uiManager;
+  CommitAttemptCounter commitAttemptCounter;
+  std::vector<Surface> surfaces;
+
+  explicit UIManagerCommitFixture(int surfaceCount) {
+    contextContainer = std::make_shared<ContextContainer>();
+
+    ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+    auto componentDescriptorRegistry =
+        componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{
+                .eventDispatcher = EventDispatcher::Shared{},
+                .contextContainer = contextContainer,
+                .flavor = nullptr});
+    componentDescriptorProviderRegistry.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    componentDescriptorProviderRegistry.add(
+        concreteComponentDescriptorProvider<ScrollViewComponentDescriptor>());
+
+    uiManager = std::make_unique<UIManager>(
+        [](std::function<void(jsi::Runtime & runtime)>&& /*callback*/) {},
+        contextContainer);
+    uiManager->setComponentDescriptorRegistry(componentDescriptorRegistry);
+
+    auto layoutConstraints = LayoutConstraints{};
+    layoutConstraints.maximumSize = Size{.width = 400, .height = 800};
+
+    auto tag = Tag{1};
+    for (auto i = 0; i < surfaceCount; i++) {
+      auto surface = Surface{.surfaceId = SurfaceId{(i + 1) * 10000}};
+      uiManager->startEmptySurface(std::make_unique<ShadowTree>(
+          surface.surfaceId,
+          layoutConstraints,
+          LayoutContext{},
+          *uiManager,
+          *contextContainer));
+
+      auto scrollViewShadowNode = uiManager->createNode(
+          tag++,
+          "ScrollView",
+          surface.surfaceId,
+          RawProps(folly::dynamic::object("height", 800)),
+          nullptr);
+      for (auto j = 0; j < kViewsPerSurface; j++) {
+        auto viewShadowNode = uiManager->createNode(
+            tag++,
+            "View",
+            surface.surfaceId,
+            RawProps(folly::dynamic::object("height", 100)),
+            nullptr);
+        uiManager->appendChild(scrollViewShadowNode, viewShadowNode);
+        surface.viewShadowNodes.push_back(viewShadowNode);
+      }
+      surface.scrollViewShadowNode = scrollViewShadowNode;
+
+      surfaces.push_back(std::move(surface));
+      auto statistics = CommitStatistics{};
+      commitFromJavaScript(surfaces.back(), 0, statistics);
+    }
+
+    uiManager->registerCommitHook(commitAttemptCounter);
+  }
+
+  ~UIManagerCommitFixture() {
+    uiManager->unregisterCommitHook(commitAttemptCounter);
+    for (const auto& surface : surfaces) {
+      uiManager->stopSurface(surface.surfaceId);
+    }
+  }
+
+  /*
+   * Visits the shadow tree of the surface, accounting the time spent waiting
+   * for the `ShadowTreeRegistry` lock.
+   */
+  void visit(
+      const Surface& surface,
+      CommitStatistics& statistics,
+      const std::function<void(const ShadowTree& shadowTree)>& callback) {
+    auto waitStartTime = telemetryTimePointNow();
+    uiManager->getShadowTreeRegistry().visit(
+        surface.surfaceId, [&](const ShadowTree& shadowTree) {
+          statistics.registryLockWaitTime +=
+              telemetryTimePointNow() - waitStartTime;
+          callback(shadowTree);
+        });
+  }
+
+  /*
+   * Commits the transaction to the surface and counts it if it succeeded.
+   */
+  void commit(
+      const Surface& surface,
+      const ShadowTreeCommitTransaction& transaction,
+      const ShadowTree::CommitOptions& commitOptions,
+      CommitStatistics& statistics) {
+    visit(surface, statistics, [&](const ShadowTree& shadowTree) {
+      auto commitStartTime = telemetryTimePointNow();
+      auto status = shadowTree.commit(transaction, commitOptions);
+      if (status == ShadowTree::CommitStatus::Succeeded) {
+        statistics.commits++;
+        statistics.commitTime += telemetryTimePointNow() - commitStartTime;
+      }
+    });
+  }
+
+  void commitFromJavaScript(
+      const Surface& surface,
+      int revision,
+      CommitStatistics& statistics) {
+    auto children =
+        std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>(
+            surface.viewShadowNodes);
+    auto& child = children->at(revision % kViewsPerSurface);
+    child = uiManager->cloneNode(
+        *child,
+        nullptr,
+        RawProps(folly::dynamic::object("opacity", 1.0 / (revision + 1))));
+
+    auto rootChildren =
+        std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>();
+    rootChildren->push_back(
+        uiManager->cloneNode(*surface.scrollViewShadowNode, children, {}));
+
+    commit(
+        surface,
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return std::make_shared<RootShadowNode>(
+              oldRootShadowNode,
+              ShadowNodeFragment{
+                  .props = ShadowNodeFragment::propsPlaceholder(),
+                  .children = rootChildren,
+              });
+        },
+        {.enableStateReconciliation = true, .mountSynchronously = true},
+        statistics);
+  }
+
+  void updateState(const Surface& surface, CommitStatistics& statistics) {
+    const auto& family = surface.scrollViewShadowNode->getFamily();
+    commit(
+        surface,
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return std::static_pointer_cast<RootShadowNode>(
+              oldRootShadowNode.cloneTree(
+                  family, [&](const ShadowNode& oldShadowNode) {
+                    auto newData = std::static_pointer_cast<
+                                       const ConcreteState<ScrollViewState>>(
+                                       oldShadowNode.getState())
+                                       ->getData();
+                    newData.contentOffset.y += 1;
+                    auto newState =
+                        family.getComponentDescriptor().createState(
+                            family,
+                            std::make_shared<const ScrollViewState>(
+                                std::move(newData)));
+                    return oldShadowNode.clone(
+                        {.props = ShadowNodeFragment::propsPlaceholder(),
+                         .children = ShadowNodeFragment::childrenPlaceholder(),
+                         .state = newState});
+                  }));
+        },
+        {/* default commit options */},
+        statistics);
+  }
+};
+
+void commitConcurrently(
+    UIManagerCommitFixture& fixture,
+    int threadIndex,
+    CommitStatistics& statistics) {
+  auto surfaceCount = static_cast<int>(fixture.surfaces.size());
+
+  for (auto i = 0; i < kCommitsPerThread; i++) {
+    const auto& surface = fixture.surfaces[(threadIndex + i) % surfaceCount];
+
+    if (i % 2 == 0) {
+      fixture.updateState(surface, statistics);
+    } else {
+      fixture.commitFromJavaScript(surface, i, statistics);
+    }
+
+    fixture.visit(surface, statistics, [&](const ShadowTree& shadowTree) {
+      auto transaction = shadowTree.getMountingCoordinator()->pullTransaction();
+      if (!transaction) {
+        return;
+      }
+      const auto& telemetry = transaction->getTelemetry();
+      statistics.mountedTransactions++;
+      statistics.commitLockWaitTime +=
+          telemetry.getCommitLockAcquisitionEndTime() -
+          telemetry.getCommitLockAcquisitionStartTime();
+    });
+  }
+}
+
+double averageMicroseconds(TelemetryDuration duration, int64_t count) {
+  return count > 0
+      ? std::chrono::duration<double, std::micro>(duration).count() /
+          static_cast<double>(count)
+      : 0;
+}
+
+} // namespace
+
+static void commitConcurrentlyToSurfaces(benchmark::State& state) {
+  auto surfaceCount = static_cast<int>(state.range(0));
+  auto threadCount = static_cast<int>(state.range(1));
+
+  ReactNativeFeatureFlags::dangerouslyReset();
+  ReactNativeFeatureFlags::override(
+      std::make_unique<CommitBenchmarkFeatureFlags>(state.range(2) != 0));
+
+  auto statistics = CommitStatistics{};
+  int64_t attempts = 0;
+
+  {
+    auto fixture = UIManagerCommitFixture{surfaceCount};
+    auto threadStatistics = std::vector<CommitStatistics>(threadCount);
+
+    for (auto _ : state) {
+      fixture.commitAttemptCounter.attempts = 0;
+      auto start = std::latch{threadCount};
+      auto threads = std::vector<std::thread>{};
+      for (auto i = 0; i < threadCount; i++) {
+        threads.emplace_back([&, i]() {
+          start.arrive_and_wait();
+          commitConcurrently(fixture, i, threadStatistics[i]);
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      attempts += fixture.commitAttemptCounter.attempts;
+    }
+
+    for (const auto& threadStatistic : threadStatistics) {
+      statistics.commits += threadStatistic.commits;
+      statistics.mountedTransactions += threadStatistic.mountedTransactions;
+      statistics.commitTime += threadStatistic.commitTime;
+      statistics.commitLockWaitTime += threadStatistic.commitLockWaitTime;
+      statistics.registryLockWaitTime += threadStatistic.registryLockWaitTime;
+    }
+  }
+
+  ReactNativeFeatureFlags::dangerouslyReset();
+
+  state.counters["commits"] = benchmark::Counter(
+      static_cast<double>(statistics.commits), benchmark::Counter::kIsRate);
+  state.counters["retries"] = statistics.commits > 0
+      ? static_cast<double>(attempts - statistics.commits) /
+          static_cast<double>(statistics.commits)
+      : 0;
+  state.counters["commitUs"] =
+      averageMicroseconds(statistics.commitTime, statistics.commits);
+  state.counters["commitLockWaitUs"] = averageMicroseconds(
+      statistics.commitLockWaitTime, statistics.mountedTransactions);
+  state.counters["registryLockWaitUs"] = averageMicroseconds(
+      statistics.registryLockWaitTime, statistics.commits);
+}
+BENCHMARK(commitConcurrentlyToSurfaces)
+    ->ArgNames({"surfaces", "threads", "recursive"})
+    ->ArgsProduct({{1, 4, 16}, {1, 4, 8}, {0, 1}})
+    ->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/utils/SimpleThreadSafeCache.h>
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Snapshot of the counters maintained by a `ShardedThreadSafeCache`.
+ */
+struct ShardedThreadSafeCacheStatistics {
+  size_t hitCount{0};
+  size_t missCount{0};
+  size_t evictionCount{0};
+  size_t entryCount{0};
+  size_t weight{0};
+};
+
+/*
+ * Thread-safe LRU cache with the same interface as `SimpleThreadSafeCache`,
+ * optimized for concurrent access and expensive generators.
+ *
+ * Entries are distributed across `shardCount` independently locked shards,
+ * each of which holds up to its share of `maxSize` entries. Generators are
+ * called outside of the shard lock, so a slow generator doesn't block readers
+ * of other keys. Concurrent misses on the same key are collapsed: only the
+ * first caller runs its generator while the others wait for the result.
+ *
+ * Instead of counting entries, the cache can be bounded by the total weight of
+ * its entries (e.g. the memory they retain), as computed by a `Weigher`.
+ */
+template <typename KeyT, typename ValueT, int maxSize, size_t shardCount = 8>
+class ShardedThreadSafeCache {
+  static_assert(shardCount > 0, "ShardedThreadSafeCache requires at least one shard.");
+
+ public:
+  using Weigher = std::function<size_t(const KeyT &key, const ValueT &value)>;
+
+  ShardedThreadSafeCache() : ShardedThreadSafeCache(static_cast<unsigned long>(maxSize)) {}
+  ShardedThreadSafeCache(unsigned long size) : ShardedThreadSafeCache(size, nullptr) {}
+
+  /*
+   * Creates a cache holding entries with a total weight of up to `maxWeight`.
+   * Every entry weighs 1 if `weigher` is empty. A shard always keeps its most
+   * recently added entry, even if that alone exceeds the shard's share.
+   */
+  ShardedThreadSafeCache(size_t maxWeight, Weigher weigher)
+      : shardMaxWeight_{std::max(size_t{1}, maxWeight / shardCount + (maxWeight % shardCount != 0 ? 1 : 0))},
+        weigher_{std::move(weigher)}
+  {
+  }
+
+  /*
+   * Returns a value from the map with a given key.
+   * If the value wasn't found in the cache, constructs the value using given
+   * generator function, stores it inside a cache and returns it.
+   * Can be called from any thread.
+   */
+  ValueT get(const KeyT &key, CacheGeneratorFunction<ValueT> auto generator) const
+  {
+    return getOrGenerate(key, std::move(generator))->second;
+  }
+
+  /*
+   * Returns both the key and value from the map with a given key.
+   * If the value wasn't found in the cache, constructs the value using given
+   * generator function, stores it inside a cache and returns it.
+   * Unlike the pointers returned by `SimpleThreadSafeCache`, the returned
+   * pointers stay valid after the entry is evicted.
+   * Can be called from any thread.
+   */
+  std::pair<std::shared_ptr<const KeyT>, std::shared_ptr<const ValueT>> getWithKey(
+      const KeyT &key,
+      CacheGeneratorFunction<ValueT> auto generator) const
+  {
+    auto entry = getOrGenerate(key, std::move(generator));
+    return std::make_pair(
+        std::shared_ptr<const KeyT>(entry, &entry->first), std::shared_ptr<const ValueT>(entry, &entry->second));
+  }
+
+  /*
+   * Returns a value from the map with a given key.
+   * If the value wasn't found in the cache, returns a default-constructed
+   * value, like `SimpleThreadSafeCache` does.
+   * Can be called from any thread.
+   */
+  std::optional<ValueT> get(const KeyT &key) const
+  {
+    auto hash = std::hash<KeyT>{}(key);
+    auto &shard = shards_[hash % shardCount];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    if (auto it = shard.find(key, hash); it != shard.list.end()) {
+      shard.hitCount++;
+      // Move accessed item to front of list
+      shard.list.splice(shard.list.begin(), shard.list, it);
+      return it->entry->second;
+    }
+
+    shard.missCount++;
+    return ValueT{};
+  }
+
+  /*
+   * Returns a snapshot of the cache counters.
+   * Can be called from any thread.
+   */
+  ShardedThreadSafeCacheStatistics getStatistics() const
+  {
+    auto statistics = ShardedThreadSafeCacheStatistics{};
+    for (auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      statistics.hitCount += shard.hitCount;
+      statistics.missCount += shard.missCount;
+      statistics.evictionCount += shard.evictionCount;
+      statistics.entryCount += shard.list.size();
+      statistics.weight += shard.weight;
+    }
+    return statistics;
+  }
+
+ private:
+  using EntryT = std::pair<KeyT, ValueT>;
+
+  /*
+   * Entries are shared with the callers of `getWithKey`, which may keep using
+   * them after they are evicted.
+   */
+  struct Node {
+    std::shared_ptr<const EntryT> entry;
+    size_t hash;
+    size_t weight;
+  };
+
+  using iterator = typename std::list<Node>::iterator;
+
+  /*
+   * A generator call in progress. `key` points to the key passed by the caller
+   * that runs the generator and is valid until `ready` is satisfied.
+   */
+  struct PendingEntry {
+    size_t hash;
+    const KeyT *key;
+    std::shared_future<void> ready;
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    std::list<Node> list;
+    // Keyed by the precomputed hash, so keys are hashed only once per lookup.
+    std::unordered_multimap<size_t, iterator> map;
+    std::vector<PendingEntry> pending;
+    size_t weight{0};
+    size_t hitCount{0};
+    size_t missCount{0};
+    size_t evictionCount{0};
+
+    iterator find(const KeyT &key, size_t hash)
+    {
+      auto [begin, end] = map.equal_range(hash);
+      for (auto it = begin; it != end; it++) {
+        if (it->second->entry->first == key) {
+          return it->second;
+        }
+      }
+      return list.end();
+    }
+
+    void erase(iterator node)
+    {
+      auto [begin, end] = map.equal_range(node->hash);
+      for (auto it = begin; it != end; it++) {
+        if (it->second == node) {
+          map.erase(it);
+          break;
+        }
+      }
+      weight -= node->weight;
+      list.erase(node);
+    }
+
+    const PendingEntry *findPending(const KeyT &key, size_t hash) const
+    {
+      for (const auto &entry : pending) {
+        if (entry.hash == hash && *entry.key == key) {
+          return &entry;
+        }
+      }
+      return nullptr;
+    }
+
+    void erasePending(const KeyT &key, size_t hash)
+    {
+      std::erase_if(pending, [&](const PendingEntry &entry) { return entry.hash == hash && entry.key == &key; });
+    }
+  };
+
+  std::shared_ptr<const EntryT> getOrGenerate(const KeyT &key, CacheGeneratorFunction<ValueT> auto generator) const
+  {
+    auto hash = std::hash<KeyT>{}(key);
+    auto &shard = shards_[hash % shardCount];
+    std::unique_lock<std::mutex> lock(shard.mutex);
+
+    while (true) {
+      if (auto it = shard.find(key, hash); it != shard.list.end()) {
+        shard.hitCount++;
+        // Move accessed item to front of list
+        shard.list.splice(shard.list.begin(), shard.list, it);
+        return it->entry;
+      }
+
+      auto pendingEntry = shard.findPending(key, hash);
+      if (pendingEntry == nullptr) {
+        break;
+      }
+
+      // Another thread is generating the value for this key; wait for it and
+      // look the key up again. If that generator threw, this thread becomes
+      // responsible for generating the value.
+      auto ready = pendingEntry->ready;
+      lock.unlock();
+      ready.wait();
+      lock.lock();
+    }
+
+    shard.missCount++;
+    auto promise = std::promise<void>{};
+    shard.pending.push_back(PendingEntry{.hash = hash, .key = &key, .ready = promise.get_future().share()});
+    lock.unlock();
+
+    auto entry = std::shared_ptr<const EntryT>{};
+    auto weight = size_t{1};
+    try {
+      entry = std::make_shared<const EntryT>(key, generator());
+      if (weigher_) {
+        weight = weigher_(entry->first, entry->second);
+      }
+    } catch (...) {
+      lock.lock();
+      shard.erasePending(key, hash);
+      lock.unlock();
+      promise.set_value();
+      throw;
+    }
+
+    // Evicted entries are released after unlocking, as destroying them may be
+    // expensive.
+    auto evictedNodes = std::list<Node>{};
+
+    lock.lock();
+    // Add new value to front of list and map
+    shard.list.push_front(Node{.entry = entry, .hash = hash, .weight = weight});
+    shard.map.emplace(hash, shard.list.begin());
+    shard.weight += weight;
+    // Evict least recently used items (back of list), but always keep the
+    // newly added one.
+    while (shard.weight > shardMaxWeight_ && shard.list.size() > 1) {
+      auto last = std::prev(shard.list.end());
+      evictedNodes.push_back(*last);
+      shard.erase(last);
+      shard.evictionCount++;
+    }
+    shard.erasePending(key, hash);
+    lock.unlock();
+
+    promise.set_value();
+    return entry;
+  }
+
+  size_t shardMaxWeight_;
+  Weigher weigher_;
+  mutable std::array<Shard, shardCount> shards_;
+};
+
+} // namespace facebook::react
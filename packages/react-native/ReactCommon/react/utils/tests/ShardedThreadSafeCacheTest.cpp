@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/utils/ShardedThreadSafeCache.h>
+
+namespace facebook::react {
+
+TEST(ShardedThreadSafeCacheTest, BasicInsertAndGet) {
+  ShardedThreadSafeCache<int, std::string, 16> cache;
+  EXPECT_EQ(cache.get(1), "");
+
+  cache.get(1, []() { return std::string("one"); });
+  cache.get(2, []() { return std::string("two"); });
+  EXPECT_EQ(cache.get(1), "one");
+  EXPECT_EQ(cache.get(2), "two");
+  EXPECT_EQ(cache.get(1, []() { return std::string("uno"); }), "one");
+
+  auto [key, value] = cache.getWithKey(3, []() { return std::string("three"); });
+  EXPECT_EQ(*key, 3);
+  EXPECT_EQ(*value, "three");
+}
+
+TEST(ShardedThreadSafeCacheTest, Eviction) {
+  // A single shard behaves exactly like `SimpleThreadSafeCache`.
+  ShardedThreadSafeCache<int, std::string, 2, 1> cache;
+  cache.get(1, []() { return std::string("one"); });
+  cache.get(2, []() { return std::string("two"); });
+  cache.get(1, []() { return std::string("one"); }); // marks key 1 as used
+  cache.get(3, []() { return std::string("three"); }); // should evict key 2
+
+  EXPECT_EQ(cache.get(1), "one");
+  EXPECT_EQ(cache.get(2), "");
+  EXPECT_EQ(cache.get(3), "three");
+}
+
+TEST(ShardedThreadSafeCacheTest, GetWithKeyOutlivesEviction) {
+  ShardedThreadSafeCache<int, std::string, 1, 1> cache;
+  auto [key, value] = cache.getWithKey(1, []() { return std::string("one"); });
+  cache.get(2, []() { return std::string("two"); }); // should evict key 1
+
+  EXPECT_EQ(cache.get(1), "");
+  EXPECT_EQ(*key, 1);
+  EXPECT_EQ(*value, "one");
+}
+
+TEST(ShardedThreadSafeCacheTest, WeightedEviction) {
+  ShardedThreadSafeCache<int, std::string, -1, 1> cache(
+      8, [](const int & /*key*/, const std::string &value) { return value.size(); });
+  cache.get(1, []() { return std::string("one"); });
+  cache.get(2, []() { return std::string("two"); });
+  cache.get(3, []() { return std::string("three"); }); // should evict key 1
+
+  EXPECT_EQ(cache.get(1), "");
+  EXPECT_EQ(cache.get(2), "two");
+  EXPECT_EQ(cache.get(3), "three");
+
+  auto statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.entryCount, 2);
+  EXPECT_EQ(statistics.weight, 8);
+  EXPECT_EQ(statistics.evictionCount, 1);
+  EXPECT_EQ(statistics.hitCount, 2);
+  EXPECT_EQ(statistics.missCount, 4);
+}
+
+TEST(ShardedThreadSafeCacheTest, SizeIsSplitAcrossShards) {
+  ShardedThreadSafeCache<int, int, 64, 8> cache;
+  for (int i = 0; i < 1000; i++) {
+    cache.get(i, [i]() { return i + 1; });
+  }
+
+  auto size = 0;
+  for (int i = 0; i < 1000; i++) {
+    size += cache.get(i) != 0 ? 1 : 0;
+  }
+  EXPECT_GT(size, 0);
+  EXPECT_LE(size, 64);
+}
+
+TEST(ShardedThreadSafeCacheTest, ConcurrentMissesCallGeneratorOnce) {
+  ShardedThreadSafeCache<int, std::string, 16> cache;
+  auto generatorCalls = std::atomic<int>{0};
+  auto threads = std::vector<std::thread>{};
+
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&]() {
+      auto value = cache.get(42, [&]() {
+        generatorCalls++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return std::string("answer");
+      });
+      EXPECT_EQ(value, "answer");
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(generatorCalls, 1);
+}
+
+TEST(ShardedThreadSafeCacheTest, GeneratorDoesNotBlockOtherKeys) {
+  ShardedThreadSafeCache<int, int, 16, 1> cache;
+  auto generatorStarted = std::atomic<bool>{false};
+  auto releaseGenerator = std::atomic<bool>{false};
+
+  auto slowThread = std::thread([&]() {
+    cache.get(1, [&]() {
+      generatorStarted = true;
+      while (!releaseGenerator) {
+        std::this_thread::yield();
+      }
+      return 1;
+    });
+  });
+
+  while (!generatorStarted) {
+    std::this_thread::yield();
+  }
+
+  // Both keys share the only shard, yet this doesn't wait for the generator
+  // above.
+  EXPECT_EQ(cache.get(2, []() { return 2; }), 2);
+  EXPECT_EQ(cache.get(2), 2);
+
+  releaseGenerator = true;
+  slowThread.join();
+  EXPECT_EQ(cache.get(1), 1);
+}
+
+TEST(ShardedThreadSafeCacheTest, ThrowingGeneratorDoesNotPoisonKey) {
+  ShardedThreadSafeCache<int, int, 16> cache;
+
+  EXPECT_THROW(
+      cache.get(1, []() -> int { throw std::runtime_error("failed"); }),
+      std::runtime_error);
+  EXPECT_EQ(cache.get(1), 0);
+  EXPECT_EQ(cache.get(1, []() { return 1; }), 1);
+}
+
+} // namespace facebook::react
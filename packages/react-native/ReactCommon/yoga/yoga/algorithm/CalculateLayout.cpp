@@ -2344,7 +2344,7 @@ bool calculateLayoutInternal(
   return (needToVisitNode || cachedResults == nullptr);
 }
 
-void calculateLayout(
+LayoutData calculateLayout(
     yoga::Node* const node,
     const float ownerWidth,
     const float ownerHeight,
@@ -2431,6 +2431,8 @@ void calculateLayout(
   }
 
   Event::publish<Event::LayoutPassEnd>(node, {&markerData});
+
+  return markerData;
 }
 
 } // namespace facebook::yoga
@@ -14,7 +14,7 @@
 
 namespace facebook::yoga {
 
-void calculateLayout(
+LayoutData calculateLayout(
     yoga::Node* node,
     float ownerWidth,
     float ownerHeight,